@@ -0,0 +1,195 @@
+/*
+ * File: Benchmark_Bounded_Queue.cpp
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+// tvj::bounded_queue (with and without spinning and batching) against a tvj::forward_list guarded by
+// a mutex and two condition variables, the throughput and the latency from push to pop
+// at various producer and consumer counts.
+// Build and run in the repository directory:
+//     g++ -std=c++14 -O2 -DNDEBUG -pthread Benchmark_Bounded_Queue.cpp -o Benchmark_Bounded_Queue && ./Benchmark_Bounded_Queue
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "TVJ_Bounded_Queue.h"
+#include "TVJ_Forward_List.h"
+
+struct Item
+{
+	uint64_t id;
+	int64_t  stamp; // the push time in ns
+};
+
+inline int64_t now_ns()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// what tvj::bounded_queue replaces
+class Locked_List_Queue
+{
+private:
+	tvj::forward_list<Item> list;
+	std::mutex mutex;
+	std::condition_variable not_full, not_empty;
+	size_t capacity;
+	bool closed = false;
+
+public:
+	Locked_List_Queue(size_t capacity_, unsigned) : capacity(capacity_) { }
+
+	void push(const Item& item)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		not_full.wait(lock, [&] { return list.size() < capacity || closed; });
+		list.push_back(item);
+		lock.unlock();
+		not_empty.notify_one();
+	}
+
+	bool pop(Item& item)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		not_empty.wait(lock, [&] { return !list.empty() || closed; });
+		if (list.empty()) return false;
+		item = *list.front();
+		list.pop_front();
+		lock.unlock();
+		not_full.notify_one();
+		return true;
+	}
+
+	void close()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			closed = true;
+		}
+		not_full.notify_all();
+		not_empty.notify_all();
+	}
+};
+
+struct Result
+{
+	double   million_per_second;
+	int64_t  p50, p99;
+	uint64_t checksum;
+};
+
+// producers push their share of items in batches, then the queue is closed and the consumers drain it
+template<typename Queue, typename Push, typename Pop>
+Result run(unsigned producers, unsigned consumers, size_t items, size_t batch, unsigned spin, Push push, Pop pop)
+{
+	Queue queue(1024, spin);
+	std::atomic<uint64_t> checksum(0);
+	std::vector<std::vector<int64_t>> latencies(consumers);
+	auto start = std::chrono::steady_clock::now();
+
+	std::vector<std::thread> threads;
+	for (unsigned c = 0; c != consumers; c++)
+	{
+		threads.emplace_back([&, c]
+			{
+				std::vector<Item> items_;
+				uint64_t sum = 0;
+				while (pop(queue, items_, batch))
+				{
+					auto now = now_ns();
+					for (const auto& item : items_)
+					{
+						sum += item.id;
+						if (item.id % 16 == 0) latencies[c].push_back(now - item.stamp);
+					}
+				}
+				checksum += sum;
+			});
+	}
+	std::vector<std::thread> producer_threads;
+	for (unsigned p = 0; p != producers; p++)
+	{
+		producer_threads.emplace_back([&, p]
+			{
+				std::vector<Item> items_;
+				for (size_t i = p; i < items; i += producers * batch)
+				{
+					items_.clear();
+					auto stamp = now_ns();
+					for (size_t j = i; j < i + producers * batch && j < items; j += producers) items_.push_back(Item{ j, stamp });
+					push(queue, items_);
+				}
+			});
+	}
+	for (auto& thread : producer_threads) thread.join();
+	queue.close();
+	for (auto& thread : threads) thread.join();
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	std::vector<int64_t> all;
+	for (const auto& samples : latencies) all.insert(all.end(), samples.begin(), samples.end());
+	std::sort(all.begin(), all.end());
+	Result result = { items / seconds / 1e6, all.empty() ? 0 : all[all.size() / 2], all.empty() ? 0 : all[all.size() * 99 / 100], checksum };
+	return result;
+}
+
+void print(const char* name, unsigned producers, unsigned consumers, const Result& result, uint64_t expected)
+{
+	std::printf("%3u x %-3u %-24s %10.2f M/s %10.1f us %10.1f us%s\n", producers, consumers, name, result.million_per_second,
+		result.p50 / 1e3, result.p99 / 1e3, result.checksum == expected ? "" : " (MISMATCH)");
+}
+
+int main()
+{
+	const size_t items = 2000000;
+	const uint64_t expected = items * (items - 1) / 2;
+
+	auto list_push = [](Locked_List_Queue& queue, const std::vector<Item>& items_) { for (const auto& item : items_) queue.push(item); };
+	auto list_pop = [](Locked_List_Queue& queue, std::vector<Item>& items_, size_t)
+	{
+		items_.resize(1);
+		return queue.pop(items_[0]);
+	};
+	auto single_push = [](tvj::bounded_queue<Item>& queue, const std::vector<Item>& items_) { for (const auto& item : items_) queue.push(item); };
+	auto single_pop = [](tvj::bounded_queue<Item>& queue, std::vector<Item>& items_, size_t)
+	{
+		items_.resize(1);
+		return queue.pop(items_[0]);
+	};
+	auto batch_push = [](tvj::bounded_queue<Item>& queue, const std::vector<Item>& items_) { queue.push_many(items_.cbegin(), items_.cend()); };
+	auto batch_pop = [](tvj::bounded_queue<Item>& queue, std::vector<Item>& items_, size_t batch)
+	{
+		items_.clear();
+		return queue.pop_many(std::back_inserter(items_), batch) != 0;
+	};
+
+	std::printf("%-9s %-24s %14s %13s %13s\n", "P x C", "queue", "throughput", "p50", "p99");
+	const unsigned counts[][2] = { { 1, 1 }, { 1, 4 }, { 4, 1 }, { 4, 4 }, { 8, 8 } };
+	for (const auto& count : counts)
+	{
+		const unsigned producers = count[0], consumers = count[1];
+		print("list + mutex", producers, consumers, run<Locked_List_Queue>(producers, consumers, items, 1, 0, list_push, list_pop), expected);
+		print("bounded_queue", producers, consumers, run<tvj::bounded_queue<Item>>(producers, consumers, items, 1, 0, single_push, single_pop), expected);
+		print("bounded_queue spin 64", producers, consumers, run<tvj::bounded_queue<Item>>(producers, consumers, items, 1, 64, single_push, single_pop), expected);
+		print("bounded_queue batch 32", producers, consumers, run<tvj::bounded_queue<Item>>(producers, consumers, items, 32, 0, batch_push, batch_pop), expected);
+	}
+	return 0;
+}
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
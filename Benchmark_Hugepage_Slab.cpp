@@ -0,0 +1,138 @@
+/*
+ * File: Benchmark_Hugepage_Slab.cpp
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+// find, count and sort of a giant tvj::hugepage_forward_list in each TVJ_HUGEPAGE_MODE against tvj::forward_list with new Node.
+// On Linux the dTLB load misses are read by perf_event_open (n/a if perf events are not permitted,
+// see /proc/sys/kernel/perf_event_paranoid). The sort relinks the nodes in random order,
+// so the find and count after it show the TLB cost of scattered nodes.
+// Build and run in the repository directory (the argument is the number of nodes, 3M by default):
+//     g++ -std=c++14 -O2 -DNDEBUG Benchmark_Hugepage_Slab.cpp -o Benchmark_Hugepage_Slab && ./Benchmark_Hugepage_Slab 3000000
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include "TVJ_Forward_List.h"
+#include "TVJ_Hugepage_Slab.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define TVJ_BENCHMARK_PERF_EVENT
+#endif
+
+// the dTLB load misses of this thread, -1 if they cannot be counted
+class dtlb_counter
+{
+private:
+	int fd = -1;
+
+public:
+	dtlb_counter()
+	{
+#ifdef TVJ_BENCHMARK_PERF_EVENT
+		perf_event_attr attr = {};
+		attr.type = PERF_TYPE_HW_CACHE;
+		attr.size = sizeof(attr);
+		attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+		attr.disabled = 1;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+	}
+
+	dtlb_counter(const dtlb_counter&) = delete;
+	dtlb_counter& operator=(const dtlb_counter&) = delete;
+
+	~dtlb_counter()
+	{
+#ifdef TVJ_BENCHMARK_PERF_EVENT
+		if (fd != -1) close(fd);
+#endif
+	}
+
+	template<typename Function>
+	long long count(Function fn)
+	{
+#ifdef TVJ_BENCHMARK_PERF_EVENT
+		if (fd != -1)
+		{
+			ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+			ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+			fn();
+			ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+			long long misses = 0;
+			if (read(fd, &misses, sizeof(misses)) == static_cast<ssize_t>(sizeof(misses))) return misses;
+			return -1;
+		}
+#endif
+		fn();
+		return -1;
+	}
+};
+
+template<typename Function>
+void measure(const char* list_name, const char* operation, Function fn)
+{
+	static dtlb_counter counter;
+	double ms = 0;
+	long long misses = counter.count([&]
+		{
+			auto start = std::chrono::steady_clock::now();
+			fn();
+			ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		});
+	std::string misses_text = misses < 0 ? "n/a" : std::to_string(misses);
+	std::printf("%-12s %-12s %11.1f ms %16s\n", list_name, operation, ms, misses_text.c_str());
+}
+
+template<typename List>
+void run(const char* name, List& list, size_t n)
+{
+	std::mt19937 rng(1);
+	for (size_t i = 0; i != n; i++) list.push_back(static_cast<int>(rng() % 1000));
+	size_t found = 0;
+	measure(name, "find", [&] { found += list.find(-1) == list.cend(); });
+	measure(name, "count", [&] { found += list.count(7); });
+	measure(name, "sort", [&] { list.sort_by_key([](int elem) { return elem ^ 0x2a5; }); });
+	measure(name, "find sorted", [&] { found += list.find(-1) == list.cend(); });
+	measure(name, "count sorted", [&] { found += list.count(7); });
+	std::printf("%-12s (checksum %zu)\n", name, found);
+}
+
+int main(int argc, char* argv[])
+{
+	const size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 3000000;
+	std::printf("%zu nodes\n%-12s %-12s %14s %16s\n", n, "list", "operation", "time", "dTLB misses");
+	{
+		tvj::forward_list<int> list;
+		run("new Node", list, n);
+	}
+	const char* names[] = { "transparent", "hugetlb", "regular" };
+	const size_t region_size = 128 * 1024 * 1024; // 64 huge pages
+	for (auto mode : { tvj::TVJ_HUGEPAGE_TRANSPARENT, tvj::TVJ_HUGEPAGE_HUGETLB, tvj::TVJ_HUGEPAGE_NONE })
+	{
+		tvj::hugepage_slab slab(region_size, mode);
+		tvj::hugepage_forward_list<int> list(slab);
+		run(names[mode], list, n);
+		std::printf("%-12s (%zu regions, %zu with huge pages)\n", names[mode], slab.reserved() / region_size, slab.huge_page_regions());
+	}
+	return 0;
+}
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
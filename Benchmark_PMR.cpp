@@ -0,0 +1,109 @@
+/*
+ * File: Benchmark_PMR.cpp
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/17
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+// tvj::pmr::forward_list on std::pmr::monotonic_buffer_resource and std::pmr::unsynchronized_pool_resource
+// against tvj::forward_list with the default new Node path.
+// Build and run in the repository directory:
+//     g++ -std=c++17 -O2 -DNDEBUG Benchmark_PMR.cpp -o Benchmark_PMR && ./Benchmark_PMR
+
+#include <chrono>
+#include <cstdio>
+#include <memory_resource>
+#include <vector>
+#include "TVJ_Forward_List.h"
+
+template<typename Function>
+double milliseconds(Function fn)
+{
+	auto start = std::chrono::steady_clock::now();
+	fn();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// one list of n elements built and destroyed
+template<typename List, typename... Args>
+long long one_list(size_t n, Args&&... args)
+{
+	List list(std::forward<Args>(args)...);
+	for (size_t i = 0; i != n; i++) list.push_back(static_cast<int>(i));
+	long long sum = 0;
+	for (auto elem : list) sum += elem;
+	return sum;
+}
+
+// a request builds a few small lists, pops half of each and drops them
+template<typename List, typename... Args>
+long long one_request(size_t lists, size_t length, Args&&... args)
+{
+	std::vector<List> request;
+	request.reserve(lists);
+	long long sum = 0;
+	for (size_t l = 0; l != lists; l++)
+	{
+		request.emplace_back(std::forward<Args>(args)...);
+		for (size_t i = 0; i != length; i++) request.back().push_back(static_cast<int>(i + l));
+		for (size_t i = 0; i != length / 2; i++) request.back().pop_front();
+		sum += request.back().size();
+	}
+	return sum;
+}
+
+int main()
+{
+	const size_t n = 1000000;
+	const size_t requests = 20000, lists = 16, length = 64;
+	long long sum_1 = 0, sum_2 = 0, sum_3 = 0;
+
+	double t_1 = milliseconds([&] { sum_1 = one_list<tvj::forward_list<int>>(n); });
+	double t_2 = milliseconds([&]
+		{
+			std::pmr::monotonic_buffer_resource resource;
+			sum_2 = one_list<tvj::pmr::forward_list<int>>(n, &resource);
+		});
+	double t_3 = milliseconds([&]
+		{
+			std::pmr::unsynchronized_pool_resource resource;
+			sum_3 = one_list<tvj::pmr::forward_list<int>>(n, &resource);
+		});
+	std::printf("%-34s %14s %14s %14s\n", "workload", "new Node", "monotonic", "pool");
+	std::printf("%-34s %11.1f ms %11.1f ms %11.1f ms%s\n", "1 list of 1M push_back", t_1, t_2, t_3,
+		sum_1 == sum_2 && sum_1 == sum_3 ? "" : " (MISMATCH)");
+
+	sum_1 = sum_2 = sum_3 = 0;
+	t_1 = milliseconds([&]
+		{
+			for (size_t r = 0; r != requests; r++) sum_1 += one_request<tvj::forward_list<int>>(lists, length);
+		});
+	t_2 = milliseconds([&]
+		{
+			// one monotonic buffer per request, released at once when the request ends
+			std::vector<unsigned char> buffer(64 * 1024);
+			for (size_t r = 0; r != requests; r++)
+			{
+				std::pmr::monotonic_buffer_resource resource(buffer.data(), buffer.size());
+				sum_2 += one_request<tvj::pmr::forward_list<int>>(lists, length, &resource);
+			}
+		});
+	t_3 = milliseconds([&]
+		{
+			// one pool shared by all requests, like a pool per shard
+			std::pmr::unsynchronized_pool_resource resource;
+			for (size_t r = 0; r != requests; r++) sum_3 += one_request<tvj::pmr::forward_list<int>>(lists, length, &resource);
+		});
+	std::printf("%-34s %11.1f ms %11.1f ms %11.1f ms%s\n", "20k requests of 16 lists x 64", t_1, t_2, t_3,
+		sum_1 == sum_2 && sum_1 == sum_3 ? "" : " (MISMATCH)");
+	return 0;
+}
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
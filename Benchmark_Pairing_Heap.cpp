@@ -0,0 +1,197 @@
+/*
+ * File: Benchmark_Pairing_Heap.cpp
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+// tvj::pairing_heap against std::priority_queue and a tvj::forward_list kept sorted
+// with search() and insert_after(), which is what the heap replaces.
+// Build and run in the repository directory:
+//     g++ -std=c++14 -O2 -DNDEBUG Benchmark_Pairing_Heap.cpp -o Benchmark_Pairing_Heap && ./Benchmark_Pairing_Heap
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+#include "TVJ_Forward_List.h"
+#include "TVJ_Pairing_Heap.h"
+
+template<typename Function>
+double milliseconds(Function fn)
+{
+	auto start = std::chrono::steady_clock::now();
+	fn();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// the three queues behind the same interface, all giving the greatest element first
+struct Pairing_Queue
+{
+	tvj::pairing_heap<int, std::greater<int>> heap;
+	void push(int x) { heap.push(x); }
+	int  top() const { return heap.top(); }
+	void pop() { heap.pop(); }
+	bool empty() const { return heap.empty(); }
+};
+
+struct Std_Queue
+{
+	std::priority_queue<int> heap;
+	void push(int x) { heap.push(x); }
+	int  top() const { return heap.top(); }
+	void pop() { heap.pop(); }
+	bool empty() const { return heap.empty(); }
+};
+
+struct Sorted_List_Queue
+{
+	tvj::forward_list<int> list; // in descending order, search() finds the node to insert after
+	void push(int x)
+	{
+		if (list.empty()) list.push_front(x);
+		else              list.insert_after(list.search(x), x);
+	}
+	int  top() const { return *list.front(); }
+	void pop() { list.pop_front(); }
+	bool empty() const { return list.empty(); }
+};
+
+// push all then pop all
+template<typename Queue>
+double fill_drain(const std::vector<int>& keys, long long& checksum)
+{
+	return milliseconds([&]
+		{
+			Queue queue;
+			for (int x : keys) queue.push(x);
+			while (!queue.empty())
+			{
+				checksum += queue.top();
+				queue.pop();
+			}
+		});
+}
+
+// the hold model: a queue of steady size where each pop is followed by a push
+template<typename Queue>
+double hold(const std::vector<int>& keys, long long& checksum)
+{
+	Queue queue;
+	for (int x : keys) queue.push(x);
+	return milliseconds([&]
+		{
+			for (int x : keys)
+			{
+				checksum += queue.top();
+				queue.pop();
+				queue.push(x);
+			}
+		});
+}
+
+// Dijkstra on a random graph, the pairing heap with decrease_key against std::priority_queue with stale entries
+void dijkstra(size_t vertices, size_t degree)
+{
+	typedef std::pair<long long, size_t> Entry; // distance, vertex
+	std::mt19937 rng(7);
+	std::vector<std::vector<std::pair<size_t, int>>> graph(vertices);
+	for (size_t v = 0; v != vertices; v++)
+	{
+		for (size_t e = 0; e != degree; e++) graph[v].emplace_back(rng() % vertices, static_cast<int>(rng() % 1000 + 1));
+	}
+	const long long infinity = -1;
+
+	std::vector<long long> dist_1(vertices, infinity);
+	double pairing = milliseconds([&]
+		{
+			tvj::pairing_heap<Entry> heap;
+			std::vector<tvj::pairing_heap<Entry>::handle> handles(vertices);
+			std::vector<bool> done(vertices);
+			dist_1[0] = 0;
+			handles[0] = heap.push(Entry(0, 0));
+			while (!heap.empty())
+			{
+				auto v = heap.top().second;
+				heap.pop();
+				done[v] = true;
+				for (const auto& edge : graph[v])
+				{
+					long long d = dist_1[v] + edge.second;
+					if (done[edge.first] || (dist_1[edge.first] != infinity && dist_1[edge.first] <= d)) continue;
+					if (dist_1[edge.first] == infinity) handles[edge.first] = heap.push(Entry(d, edge.first));
+					else                                heap.decrease_key(handles[edge.first], Entry(d, edge.first));
+					dist_1[edge.first] = d;
+				}
+			}
+		});
+
+	std::vector<long long> dist_2(vertices, infinity);
+	double standard = milliseconds([&]
+		{
+			std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+			dist_2[0] = 0;
+			heap.push(Entry(0, 0));
+			while (!heap.empty())
+			{
+				auto top = heap.top();
+				heap.pop();
+				if (top.first != dist_2[top.second]) continue; // stale entry
+				for (const auto& edge : graph[top.second])
+				{
+					long long d = top.first + edge.second;
+					if (dist_2[edge.first] != infinity && dist_2[edge.first] <= d) continue;
+					dist_2[edge.first] = d;
+					heap.push(Entry(d, edge.first));
+				}
+			}
+		});
+	std::printf("dijkstra %zu vertices x %zu edges: pairing_heap %8.1f ms, std::priority_queue %8.1f ms%s\n",
+		vertices, degree, pairing, standard, dist_1 == dist_2 ? "" : " (MISMATCH)");
+}
+
+int main()
+{
+	std::mt19937 rng(1);
+	std::printf("%10s %-10s %14s %14s %14s\n", "n", "workload", "pairing_heap", "std::pq", "sorted list");
+	for (size_t n : { 1000, 10000, 100000, 1000000 })
+	{
+		std::vector<int> keys(n);
+		for (auto& x : keys) x = static_cast<int>(rng() >> 1);
+		const bool with_list = n <= 10000; // every push into the sorted list is O(n)
+
+		long long sum_1 = 0, sum_2 = 0, sum_3 = 0;
+		double t_1 = fill_drain<Pairing_Queue>(keys, sum_1);
+		double t_2 = fill_drain<Std_Queue>(keys, sum_2);
+		double t_3 = with_list ? fill_drain<Sorted_List_Queue>(keys, sum_3) : 0;
+		if (!with_list) sum_3 = sum_1;
+		std::printf("%10zu %-10s %11.2f ms %11.2f ms ", n, "fill+drain", t_1, t_2);
+		if (with_list) std::printf("%11.2f ms", t_3);
+		else           std::printf("%14s", "-");
+		std::printf("%s\n", sum_1 == sum_2 && sum_1 == sum_3 ? "" : " (MISMATCH)");
+
+		sum_1 = sum_2 = sum_3 = 0;
+		t_1 = hold<Pairing_Queue>(keys, sum_1);
+		t_2 = hold<Std_Queue>(keys, sum_2);
+		t_3 = with_list ? hold<Sorted_List_Queue>(keys, sum_3) : 0;
+		if (!with_list) sum_3 = sum_1;
+		std::printf("%10zu %-10s %11.2f ms %11.2f ms ", n, "hold", t_1, t_2);
+		if (with_list) std::printf("%11.2f ms", t_3);
+		else           std::printf("%14s", "-");
+		std::printf("%s\n", sum_1 == sum_2 && sum_1 == sum_3 ? "" : " (MISMATCH)");
+	}
+	dijkstra(200000, 8);
+	return 0;
+}
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
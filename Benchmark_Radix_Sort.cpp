@@ -0,0 +1,110 @@
+/*
+ * File: Benchmark_Radix_Sort.cpp
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+// radix_sort() of tvj::forward_list<std::string> against its comparison sort() and std::forward_list::sort()
+// on URLs and log keys, which share long prefixes. sort() grows quadratically with these lists,
+// so it only runs on the smallest size.
+// Build and run in the repository directory:
+//     g++ -std=c++14 -O2 -DNDEBUG Benchmark_Radix_Sort.cpp -o Benchmark_Radix_Sort && ./Benchmark_Radix_Sort
+
+#include <chrono>
+#include <cstdio>
+#include <forward_list>
+#include <random>
+#include <string>
+#include <vector>
+#include "TVJ_Forward_List.h"
+
+template<typename Function>
+double milliseconds(Function fn)
+{
+	auto start = std::chrono::steady_clock::now();
+	fn();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// URLs of a few hosts with paths of a few levels and query strings
+std::vector<std::string> urls(size_t n)
+{
+	static const char* hosts[] = { "https://www.example.com/", "https://api.example.com/v2/", "https://cdn.example.org/static/", "http://shop.example.net/" };
+	static const char* words[] = { "products", "users", "orders", "images", "search", "category", "item", "profile", "settings", "cart" };
+	std::mt19937 rng(1);
+	std::vector<std::string> data(n);
+	for (auto& url : data)
+	{
+		url = hosts[rng() % 4];
+		for (unsigned depth = rng() % 4 + 1; depth; depth--)
+		{
+			url += words[rng() % 10];
+			url += '/';
+		}
+		url += std::to_string(rng() % 100000);
+		if (rng() % 2) url += "?page=" + std::to_string(rng() % 50);
+	}
+	return data;
+}
+
+// log keys of a timestamp, a service and a host
+std::vector<std::string> log_keys(size_t n)
+{
+	std::mt19937 rng(2);
+	std::vector<std::string> data(n);
+	char buffer[96];
+	for (auto& key : data)
+	{
+		std::snprintf(buffer, sizeof(buffer), "2026-10-18T%02u:%02u:%02u.%03uZ/service-%02u/host-%03u/req-%06u",
+			static_cast<unsigned>(rng() % 24), static_cast<unsigned>(rng() % 60), static_cast<unsigned>(rng() % 60),
+			static_cast<unsigned>(rng() % 1000), static_cast<unsigned>(rng() % 16), static_cast<unsigned>(rng() % 200),
+			static_cast<unsigned>(rng() % 1000000));
+		key = buffer;
+	}
+	return data;
+}
+
+void run(const char* name, const std::vector<std::string>& data)
+{
+	const bool with_sort = data.size() <= 10000;
+	tvj::forward_list<std::string> list_1(data), list_2(with_sort ? data : std::vector<std::string>());
+	std::forward_list<std::string> list_3(data.cbegin(), data.cend());
+	double radix = milliseconds([&] { list_1.radix_sort(); });
+	double comparison = milliseconds([&] { list_2.sort(); });
+	double standard = milliseconds([&] { list_3.sort(); });
+
+	bool same = true;
+	auto iter_2 = list_2.cbegin();
+	auto iter_3 = list_3.cbegin();
+	for (const auto& elem : list_1)
+	{
+		if (with_sort) same = same && elem == *iter_2++;
+		same = same && elem == *iter_3;
+		++iter_3;
+	}
+	std::printf("%-9s %8zu %11.1f ms ", name, data.size(), radix);
+	if (with_sort) std::printf("%11.1f ms ", comparison);
+	else           std::printf("%14s ", "-");
+	std::printf("%11.1f ms%s\n", standard, same ? "" : " (MISMATCH)");
+}
+
+int main()
+{
+	std::printf("%-9s %8s %14s %14s %14s\n", "data", "n", "radix_sort", "sort", "std::fl::sort");
+	for (size_t n : { 10000, 100000, 1000000 })
+	{
+		run("urls", urls(n));
+		run("log keys", log_keys(n));
+	}
+	return 0;
+}
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
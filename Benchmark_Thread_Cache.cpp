@@ -0,0 +1,121 @@
+/*
+ * File: Benchmark_Thread_Cache.cpp
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+// tvj::thread_cache_forward_list against tvj::forward_list with new Node when many threads churn their own lists,
+// and when the lists built by one thread are destroyed by another.
+// Build and run in the repository directory:
+//     g++ -std=c++14 -O2 -DNDEBUG -pthread Benchmark_Thread_Cache.cpp -o Benchmark_Thread_Cache && ./Benchmark_Thread_Cache
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include "TVJ_Forward_List.h"
+#include "TVJ_Thread_Cache.h"
+
+template<typename Function>
+double milliseconds(Function fn)
+{
+	auto start = std::chrono::steady_clock::now();
+	fn();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// each thread fills and empties its own lists
+template<typename List>
+double churn(unsigned threads, size_t rounds, std::atomic<long long>& checksum)
+{
+	return milliseconds([&]
+		{
+			std::vector<std::thread> workers;
+			for (unsigned t = 0; t != threads; t++)
+			{
+				workers.emplace_back([&, t]
+					{
+						long long sum = 0;
+						List lists[4];
+						for (size_t r = 0; r != rounds; r++)
+						{
+							auto& list = lists[r % 4];
+							for (int i = 0; i != 128; i++) list.push_back(i + static_cast<int>(t));
+							for (int i = 0; i != 96; i++)
+							{
+								sum += *list.begin();
+								list.pop_front();
+							}
+						}
+						checksum += sum;
+					});
+			}
+			for (auto& worker : workers) worker.join();
+		});
+}
+
+// each thread builds lists, then the lists of the next thread are destroyed by it
+template<typename List>
+double handoff(unsigned threads, size_t lists, std::atomic<long long>& checksum)
+{
+	std::vector<std::vector<List>> built(threads);
+	return milliseconds([&]
+		{
+			std::vector<std::thread> workers;
+			for (unsigned t = 0; t != threads; t++)
+			{
+				workers.emplace_back([&, t]
+					{
+						built[t].resize(lists);
+						for (auto& list : built[t])
+						{
+							for (int i = 0; i != 256; i++) list.push_back(i);
+						}
+					});
+			}
+			for (auto& worker : workers) worker.join();
+			workers.clear();
+			for (unsigned t = 0; t != threads; t++)
+			{
+				workers.emplace_back([&, t]
+					{
+						auto& other = built[(t + 1) % threads];
+						long long sum = 0;
+						for (auto& list : other) sum += list.size();
+						other.clear();
+						checksum += sum;
+					});
+			}
+			for (auto& worker : workers) worker.join();
+		});
+}
+
+int main()
+{
+	const size_t rounds = 20000, lists = 2000;
+	std::printf("%8s %-8s %14s %14s\n", "threads", "workload", "new Node", "thread cache");
+	for (unsigned threads : { 1, 4, 8, 16, 32 })
+	{
+		std::atomic<long long> sum_1(0), sum_2(0);
+		double t_1 = churn<tvj::forward_list<int>>(threads, rounds, sum_1);
+		double t_2 = churn<tvj::thread_cache_forward_list<int>>(threads, rounds, sum_2);
+		std::printf("%8u %-8s %11.1f ms %11.1f ms%s\n", threads, "churn", t_1, t_2, sum_1 == sum_2 ? "" : " (MISMATCH)");
+
+		sum_1 = sum_2 = 0;
+		t_1 = handoff<tvj::forward_list<int>>(threads, lists, sum_1);
+		t_2 = handoff<tvj::thread_cache_forward_list<int>>(threads, lists, sum_2);
+		std::printf("%8u %-8s %11.1f ms %11.1f ms%s\n", threads, "handoff", t_1, t_2, sum_1 == sum_2 ? "" : " (MISMATCH)");
+	}
+	return 0;
+}
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
@@ -0,0 +1,133 @@
+/*
+ * File: Benchmark_Timer_Wheel.cpp
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+// tvj::timer_wheel throughput (schedule, cancel, fire) against a std::priority_queue of expiries,
+// and the latency of single ticks with and without a cascade from the higher levels.
+// Build and run in the repository directory:
+//     g++ -std=c++14 -O2 -DNDEBUG Benchmark_Timer_Wheel.cpp -o Benchmark_Timer_Wheel && ./Benchmark_Timer_Wheel
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+#include "TVJ_Timer_Wheel.h"
+
+template<typename Function>
+double milliseconds(Function fn)
+{
+	auto start = std::chrono::steady_clock::now();
+	fn();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// schedule n timers, cancel every fourth one and run until all have fired
+void throughput(size_t n, uint64_t horizon)
+{
+	std::mt19937_64 rng(1);
+	std::vector<uint64_t> delays(n);
+	for (auto& delay : delays) delay = rng() % horizon + 1;
+
+	uint64_t sum_1 = 0;
+	double schedule_1 = 0, cancel_1 = 0, fire_1 = 0;
+	{
+		tvj::timer_wheel<uint64_t> wheel;
+		std::vector<tvj::timer_wheel<uint64_t>::handle> handles(n);
+		schedule_1 = milliseconds([&]
+			{
+				for (size_t i = 0; i != n; i++) handles[i] = wheel.schedule(delays[i], i);
+			});
+		cancel_1 = milliseconds([&]
+			{
+				for (size_t i = 0; i < n; i += 4) wheel.cancel(handles[i]);
+			});
+		fire_1 = milliseconds([&] { wheel.advance(horizon, [&](uint64_t& id) { sum_1 += id; }); });
+	}
+
+	// the heap cancels lazily by a flag checked when the timer is popped
+	typedef std::pair<uint64_t, uint64_t> Entry; // expiry, id
+	uint64_t sum_2 = 0;
+	double schedule_2 = 0, cancel_2 = 0, fire_2 = 0;
+	{
+		std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+		std::vector<bool> cancelled(n);
+		schedule_2 = milliseconds([&]
+			{
+				for (size_t i = 0; i != n; i++) heap.emplace(delays[i], i);
+			});
+		cancel_2 = milliseconds([&]
+			{
+				for (size_t i = 0; i < n; i += 4) cancelled[i] = true;
+			});
+		fire_2 = milliseconds([&]
+			{
+				for (uint64_t now = 1; now <= horizon; now++)
+				{
+					while (!heap.empty() && heap.top().first <= now)
+					{
+						if (!cancelled[heap.top().second]) sum_2 += heap.top().second;
+						heap.pop();
+					}
+				}
+			});
+	}
+	const char* mismatch = sum_1 == sum_2 ? "" : " (MISMATCH)";
+	std::printf("%zu timers over %llu ticks (ns per timer)\n", n, static_cast<unsigned long long>(horizon));
+	std::printf("%-22s %10s %10s %10s\n", "", "schedule", "cancel", "fire");
+	std::printf("%-22s %10.1f %10.1f %10.1f%s\n", "tvj::timer_wheel", schedule_1 * 1e6 / n, cancel_1 * 4e6 / n, fire_1 * 1e6 / n, mismatch);
+	std::printf("%-22s %10.1f %10.1f %10.1f%s\n", "std::priority_queue", schedule_2 * 1e6 / n, cancel_2 * 4e6 / n, fire_2 * 1e6 / n, mismatch);
+}
+
+// the time of each advance(1) while timers are rescheduled at a steady rate,
+// the ticks where level 1 cascades into level 0 (every 256 ticks) are reported apart
+void tick_latency(size_t timers, uint64_t ticks)
+{
+	std::mt19937_64 rng(2);
+	tvj::timer_wheel<uint64_t> wheel;
+	const uint64_t horizon = 1 << 16;
+	for (size_t i = 0; i != timers; i++) wheel.schedule(rng() % horizon + 1, i);
+
+	std::vector<double> plain, cascade;
+	uint64_t fired = 0;
+	for (uint64_t t = 0; t != ticks; t++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		size_t count = wheel.advance(1, [&](uint64_t& id) { fired += id; });
+		double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+		(wheel.now() % 256 == 0 ? cascade : plain).push_back(ns);
+		for (size_t i = 0; i != count; i++) wheel.schedule(rng() % horizon + 1, i); // keep the number of timers steady
+	}
+
+	std::printf("tick latency with %zu timers (ns)\n%-22s %10s %10s %10s %10s\n", timers, "", "p50", "p99", "max", "ticks");
+	for (auto samples : { std::make_pair("plain tick", &plain), std::make_pair("cascading tick", &cascade) })
+	{
+		auto& times = *samples.second;
+		std::sort(times.begin(), times.end());
+		std::printf("%-22s %10.0f %10.0f %10.0f %10zu\n", samples.first, times[times.size() / 2], times[times.size() * 99 / 100], times.back(), times.size());
+	}
+	std::printf("(checksum %llu)\n", static_cast<unsigned long long>(fired));
+}
+
+int main()
+{
+	throughput(10000000, 1000000);
+	tick_latency(1000000, 1 << 18);
+	return 0;
+}
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
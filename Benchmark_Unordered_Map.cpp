@@ -0,0 +1,105 @@
+/*
+ * File: Benchmark_Unordered_Map.cpp
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+// tvj::unordered_map against std::unordered_map on integer and string keys.
+// Build and run in the repository directory:
+//     g++ -std=c++14 -O2 -DNDEBUG Benchmark_Unordered_Map.cpp -o Benchmark_Unordered_Map && ./Benchmark_Unordered_Map
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "TVJ_Unordered_Map.h"
+
+template<typename Function>
+double milliseconds(Function fn)
+{
+	auto start = std::chrono::steady_clock::now();
+	fn();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+struct Result
+{
+	double insert, find_hit, find_miss, erase;
+	uint64_t checksum;
+};
+
+// insert the first half of the keys, find all of them (half hit, half miss), erase every other inserted key
+template<typename Map, typename Key>
+Result run(const std::vector<Key>& keys)
+{
+	const size_t half = keys.size() / 2;
+	Result result = {};
+	Map map;
+	result.insert = milliseconds([&]
+		{
+			for (size_t i = 0; i != half; i++) map.emplace(keys[i], i);
+		});
+	result.find_hit = milliseconds([&]
+		{
+			for (size_t i = 0; i != half; i++)
+			{
+				auto iter = map.find(keys[i]);
+				if (iter != map.end()) result.checksum += iter->second;
+			}
+		});
+	result.find_miss = milliseconds([&]
+		{
+			for (size_t i = half; i != keys.size(); i++) result.checksum += map.find(keys[i]) == map.end();
+		});
+	result.erase = milliseconds([&]
+		{
+			for (size_t i = 0; i < half; i += 2) result.checksum += map.erase(keys[i]);
+		});
+	result.checksum += map.size();
+	return result;
+}
+
+template<typename Key>
+void compare(const char* name, const std::vector<Key>& keys)
+{
+	auto tvj_result = run<tvj::unordered_map<Key, uint64_t>>(keys);
+	auto std_result = run<std::unordered_map<Key, uint64_t>>(keys);
+	const char* mismatch = tvj_result.checksum == std_result.checksum ? "" : " (MISMATCH)";
+	std::printf("%-20s %-22s %9.1f ms %9.1f ms %9.1f ms %9.1f ms%s\n", name, "tvj::unordered_map",
+		tvj_result.insert, tvj_result.find_hit, tvj_result.find_miss, tvj_result.erase, mismatch);
+	std::printf("%-20s %-22s %9.1f ms %9.1f ms %9.1f ms %9.1f ms%s\n", name, "std::unordered_map",
+		std_result.insert, std_result.find_hit, std_result.find_miss, std_result.erase, mismatch);
+}
+
+int main()
+{
+	const size_t n = 2000000; // half inserted, half missing
+	std::printf("%-20s %-22s %12s %12s %12s %12s\n", "keys", "map", "insert", "find hit", "find miss", "erase");
+
+	std::vector<uint64_t> sequential(n);
+	for (size_t i = 0; i != n; i++) sequential[i] = i;
+	compare("sequential uint64", sequential);
+
+	std::mt19937_64 rng(1);
+	std::vector<uint64_t> random(n);
+	for (auto& key : random) key = rng();
+	compare("random uint64", random);
+
+	std::vector<std::string> strings(n);
+	for (size_t i = 0; i != n; i++) strings[i] = "user:" + std::to_string(rng() % 100000000) + ":session:" + std::to_string(i);
+	compare("strings", strings);
+	return 0;
+}
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
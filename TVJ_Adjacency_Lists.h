@@ -0,0 +1,420 @@
+/*
+ * File: TVJ_Adjacency_Lists.h
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "TVJ_Forward_List.h"
+
+namespace tvj
+{
+	// The adjacency lists of a directed graph whose vertices are 0, 1, ..., vertex_count() - 1.
+	// The edge nodes of all vertices live in one array and are linked by 32-bit indices
+	// (1-based, 0 stands for the end), each vertex only keeps the index of its first edge.
+	// freeze() converts the lists to the CSR (compressed sparse row) layout for traversals,
+	// and thaw() (or add_edge() on a frozen graph) converts them back in O(V + E).
+	class adjacency_lists
+	{
+	protected:
+		// the class of the edge node
+		struct Edge
+		{
+			uint32_t target;
+			uint32_t succ; // the index + 1 of the next edge of the same source (0 for the end)
+		};
+
+	private:
+		std::vector<Edge>     edges;   // the edge nodes (empty when frozen)
+		std::vector<uint32_t> heads;   // the index + 1 of the first edge of each vertex (empty when frozen)
+		std::vector<uint32_t> offsets; // CSR: the first target of each vertex and the end (empty when not frozen)
+		std::vector<uint32_t> targets; // CSR: the targets grouped by source (empty when not frozen)
+		uint32_t vertices;
+		bool     frozen_ = false;
+
+	public:
+		// The iterator over the neighbors of a vertex, it works in both layouts.
+		class const_iterator
+		{
+			friend class adjacency_lists;
+
+		protected:
+			const Edge*     edges = nullptr; // nullptr for the CSR layout
+			const uint32_t* ptr   = nullptr; // the CSR target
+			uint32_t        link  = 0;       // the index + 1 of the edge node
+
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef uint32_t                  value_type;
+			typedef std::ptrdiff_t            difference_type;
+			typedef const uint32_t*           pointer;
+			typedef const uint32_t&           reference;
+
+			const_iterator() = default;
+		public:
+			inline const uint32_t& operator*() const;
+			inline const_iterator& operator++();
+			inline const_iterator operator++(int);
+			inline bool operator==(const const_iterator& iter) const noexcept;
+			inline bool operator!=(const const_iterator& iter) const noexcept;
+		};
+
+		// The range of the neighbors of a vertex.
+		class neighbor_range
+		{
+			friend class adjacency_lists;
+
+		protected:
+			const_iterator first;
+			const_iterator last;
+
+		public:
+			inline const_iterator begin() const noexcept;
+			inline const_iterator end() const noexcept;
+			inline bool empty() const noexcept;
+		};
+
+		/**
+		 * brief: constructor
+		 * param: the number of vertices, the number of edges to reserve
+		 * return: --
+		 */
+		explicit adjacency_lists(uint32_t vertex_count = 0, size_t edge_capacity = 0);
+
+		/**
+		 * brief: add a vertex (the graph is thawed if frozen)
+		 * param: (void)
+		 * return: uint32_t (the new vertex)
+		 */
+		uint32_t add_vertex();
+
+		/**
+		 * brief: add an edge in O(1) (amortized), it becomes the first neighbor of the source;
+		 *        the graph is thawed first if frozen
+		 * param: the source, the target
+		 * return: void
+		 */
+		void add_edge(uint32_t from, uint32_t to);
+
+		/**
+		 * brief: reserve the edge nodes
+		 * param: the number of edges
+		 * return: void
+		 */
+		void reserve(size_t edge_capacity);
+
+		/**
+		 * brief: convert to the CSR layout, the order of the neighbors is kept
+		 * param: (void)
+		 * return: void
+		 */
+		void freeze();
+
+		/**
+		 * brief: convert back to the linked layout, the order of the neighbors is kept
+		 * param: (void)
+		 * return: void
+		 */
+		void thaw();
+
+		/**
+		 * brief: if the graph is in the CSR layout
+		 * param: (void)
+		 * return: bool
+		 */
+		inline bool frozen() const noexcept;
+
+		/**
+		 * brief: the neighbors of a vertex
+		 * param: the vertex
+		 * return: neighbor_range
+		 */
+		inline neighbor_range neighbors(uint32_t vertex) const;
+
+		/**
+		 * brief: the out degree of a vertex, O(1) if frozen and O(degree) otherwise
+		 * param: the vertex
+		 * return: size_t
+		 */
+		size_t degree(uint32_t vertex) const;
+
+		/**
+		 * brief: visit the vertices reachable from the source in breadth-first order
+		 * param: the source, the function called with uint32_t
+		 * return: size_t (number of visited vertices)
+		 */
+		template<typename Function>
+		size_t bfs(uint32_t source, Function fn) const;
+
+		/**
+		 * brief: visit the vertices reachable from the source in depth-first preorder
+		 * param: the source, the function called with uint32_t
+		 * return: size_t (number of visited vertices)
+		 */
+		template<typename Function>
+		size_t dfs(uint32_t source, Function fn) const;
+
+		/**
+		 * brief: the number of vertices
+		 * param: (void)
+		 * return: uint32_t
+		 */
+		inline uint32_t vertex_count() const noexcept;
+
+		/**
+		 * brief: the number of edges
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t edge_count() const noexcept;
+
+		/**
+		 * brief: remove all edges (the vertices are kept)
+		 * param: (void)
+		 * return: void
+		 */
+		void clear();
+	};
+
+	const uint32_t& adjacency_lists::const_iterator::operator*() const
+	{
+#ifndef NDEBUG
+		if (edges ? !link : !ptr) error_info("Dereference of end() of tvj::adjacency_lists neighbors.", TVJ_FORWARD_LIST_NULLPTR);
+#endif
+		return edges ? edges[link - 1].target : *ptr;
+	}
+
+	adjacency_lists::const_iterator& adjacency_lists::const_iterator::operator++()
+	{
+#ifndef NDEBUG
+		if (edges ? !link : !ptr) error_info("Increment of end() of tvj::adjacency_lists neighbors.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		if (edges) link = edges[link - 1].succ;
+		else       ++ptr;
+		return *this;
+	}
+
+	adjacency_lists::const_iterator adjacency_lists::const_iterator::operator++(int)
+	{
+		auto tmp = *this;
+		++*this;
+		return tmp;
+	}
+
+	bool adjacency_lists::const_iterator::operator==(const const_iterator& iter) const noexcept
+	{
+		return ptr == iter.ptr && link == iter.link;
+	}
+
+	bool adjacency_lists::const_iterator::operator!=(const const_iterator& iter) const noexcept
+	{
+		return !(*this == iter);
+	}
+
+	adjacency_lists::const_iterator adjacency_lists::neighbor_range::begin() const noexcept
+	{
+		return first;
+	}
+
+	adjacency_lists::const_iterator adjacency_lists::neighbor_range::end() const noexcept
+	{
+		return last;
+	}
+
+	bool adjacency_lists::neighbor_range::empty() const noexcept
+	{
+		return first == last;
+	}
+
+	inline adjacency_lists::adjacency_lists(uint32_t vertex_count, size_t edge_capacity) : heads(vertex_count, 0), vertices(vertex_count)
+	{
+		edges.reserve(edge_capacity);
+	}
+
+	inline uint32_t adjacency_lists::add_vertex()
+	{
+		if (frozen_) thaw();
+		if (vertices == UINT32_MAX) throw std::length_error("Too many vertices in tvj::adjacency_lists.");
+		heads.push_back(0);
+		return vertices++;
+	}
+
+	inline void adjacency_lists::add_edge(uint32_t from, uint32_t to)
+	{
+#ifndef NDEBUG
+		if (from >= vertices || to >= vertices) error_info("Vertex out of range in add_edge of tvj::adjacency_lists.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		if (frozen_) thaw();
+		if (edges.size() == UINT32_MAX) throw std::length_error("Too many edges in tvj::adjacency_lists.");
+		edges.push_back(Edge{ to, heads[from] });
+		heads[from] = static_cast<uint32_t>(edges.size());
+	}
+
+	inline void adjacency_lists::reserve(size_t edge_capacity)
+	{
+		if (frozen_) targets.reserve(edge_capacity);
+		else         edges.reserve(edge_capacity);
+	}
+
+	inline void adjacency_lists::freeze()
+	{
+		if (frozen_) return;
+		offsets.assign(size_t(vertices) + 1, 0);
+		targets.resize(edges.size());
+		uint32_t pos = 0;
+		for (uint32_t v = 0; v != vertices; v++)
+		{
+			offsets[v] = pos;
+			for (auto link = heads[v]; link; link = edges[link - 1].succ) targets[pos++] = edges[link - 1].target;
+		}
+		offsets[vertices] = pos;
+		std::vector<Edge>().swap(edges);
+		std::vector<uint32_t>().swap(heads);
+		frozen_ = true;
+	}
+
+	inline void adjacency_lists::thaw()
+	{
+		if (!frozen_) return;
+		// the edges of each vertex become consecutive nodes, so the lists are as contiguous as the CSR
+		edges.resize(targets.size());
+		heads.assign(vertices, 0);
+		for (uint32_t v = 0; v != vertices; v++)
+		{
+			const uint32_t first = offsets[v], last = offsets[v + 1];
+			if (first == last) continue;
+			heads[v] = first + 1;
+			for (auto i = first; i != last; i++) edges[i] = Edge{ targets[i], i + 2 };
+			edges[last - 1].succ = 0;
+		}
+		std::vector<uint32_t>().swap(offsets);
+		std::vector<uint32_t>().swap(targets);
+		frozen_ = false;
+	}
+
+	bool adjacency_lists::frozen() const noexcept
+	{
+		return frozen_;
+	}
+
+	adjacency_lists::neighbor_range adjacency_lists::neighbors(uint32_t vertex) const
+	{
+#ifndef NDEBUG
+		if (vertex >= vertices) error_info("Vertex out of range in neighbors of tvj::adjacency_lists.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		neighbor_range range;
+		if (frozen_)
+		{
+			range.first.ptr = targets.data() + offsets[vertex];
+			range.last.ptr = targets.data() + offsets[vertex + 1];
+		}
+		else
+		{
+			range.first.edges = range.last.edges = edges.data();
+			range.first.link = heads[vertex];
+		}
+		return range;
+	}
+
+	inline size_t adjacency_lists::degree(uint32_t vertex) const
+	{
+#ifndef NDEBUG
+		if (vertex >= vertices) error_info("Vertex out of range in degree of tvj::adjacency_lists.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		if (frozen_) return offsets[vertex + 1] - offsets[vertex];
+		size_t n = 0;
+		for (auto link = heads[vertex]; link; link = edges[link - 1].succ) n++;
+		return n;
+	}
+
+	template<typename Function>
+	size_t adjacency_lists::bfs(uint32_t source, Function fn) const
+	{
+#ifndef NDEBUG
+		if (source >= vertices) error_info("Vertex out of range in bfs of tvj::adjacency_lists.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		std::vector<bool> visited(vertices, false);
+		std::vector<uint32_t> queue;
+		queue.push_back(source);
+		visited[source] = true;
+		for (size_t i = 0; i != queue.size(); i++)
+		{
+			const auto v = queue[i];
+			fn(v);
+			for (auto w : neighbors(v))
+			{
+				if (visited[w]) continue;
+				visited[w] = true;
+				queue.push_back(w);
+			}
+		}
+		return queue.size();
+	}
+
+	template<typename Function>
+	size_t adjacency_lists::dfs(uint32_t source, Function fn) const
+	{
+#ifndef NDEBUG
+		if (source >= vertices) error_info("Vertex out of range in dfs of tvj::adjacency_lists.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		// the stack keeps the position in the neighbors of each vertex on the path
+		std::vector<bool> visited(vertices, false);
+		std::vector<neighbor_range> stack;
+		size_t count = 1;
+		visited[source] = true;
+		fn(source);
+		stack.push_back(neighbors(source));
+		while (!stack.empty())
+		{
+			auto& top = stack.back();
+			if (top.empty())
+			{
+				stack.pop_back();
+				continue;
+			}
+			const auto w = *top.first++;
+			if (visited[w]) continue;
+			visited[w] = true;
+			count++;
+			fn(w);
+			stack.push_back(neighbors(w));
+		}
+		return count;
+	}
+
+	uint32_t adjacency_lists::vertex_count() const noexcept
+	{
+		return vertices;
+	}
+
+	size_t adjacency_lists::edge_count() const noexcept
+	{
+		return frozen_ ? targets.size() : edges.size();
+	}
+
+	inline void adjacency_lists::clear()
+	{
+		edges.clear();
+		heads.assign(vertices, 0);
+		offsets.clear();
+		targets.clear();
+		frozen_ = false;
+	}
+};
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
@@ -0,0 +1,313 @@
+/*
+ * File: TVJ_Arena.h
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include "TVJ_Forward_List.h"
+
+namespace tvj
+{
+	// The request-scoped arena that lists can be bound to (by tvj::arena_allocator),
+	// the memory is bump-allocated from large chunks and released all at once by reset().
+	class arena
+	{
+	protected:
+		// the header of a memory chunk, chunks are connected by succ
+		struct Chunk
+		{
+			Chunk* succ;
+			size_t size; // the usable bytes after the header
+		};
+
+	private:
+		Chunk* first     = nullptr; // the first chunk
+		Chunk* current   = nullptr; // the chunk being used
+		size_t offset    = 0;       // the used bytes in current
+		size_t chunk_size;          // the default size of a new chunk
+		size_t generation_ = 0;     // increased by each reset()
+
+		// the start address of the usable bytes of a chunk
+		static inline unsigned char* _data(Chunk* chunk) noexcept;
+
+		// make a new chunk after current with at least bytes usable
+		void _grow(size_t bytes);
+
+	public:
+		/**
+		 * brief: constructor
+		 * param: the default chunk size in bytes
+		 * return: --
+		 */
+		explicit arena(size_t chunk_size_ = 64 * 1024);
+
+		arena(const arena&) = delete;
+		arena& operator=(const arena&) = delete;
+
+		/**
+		 * brief: destructor, all chunks are released
+		 * param: (void)
+		 * return: --
+		 */
+		~arena();
+
+		/**
+		 * brief: bump-allocate memory
+		 * param: the size and the alignment in bytes
+		 * return: void*
+		 */
+		void* allocate(size_t bytes, size_t alignment);
+
+		/**
+		 * brief: drop all the memory allocated in O(1), the chunks are kept for reuse,
+		 *        lists bound to the arena before become invalid (checked during DEBUG)
+		 * param: (void)
+		 * return: void
+		 */
+		inline void reset() noexcept;
+
+		/**
+		 * brief: reset and return all the chunks to the system
+		 * param: (void)
+		 * return: void
+		 */
+		void release() noexcept;
+
+		/**
+		 * brief: the generation which is increased by each reset()
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t generation() const noexcept;
+
+		/**
+		 * brief: the bytes reserved from the system
+		 * param: (void)
+		 * return: size_t
+		 */
+		size_t reserved() const noexcept;
+	};
+
+	// The allocator binding containers to a tvj::arena,
+	// deallocate() does nothing and the memory is released by arena::reset().
+	template<typename T>
+	class arena_allocator
+	{
+		template<typename U> friend class arena_allocator;
+
+	private:
+		arena* arena_;
+		size_t generation_; // the generation of the arena when bound
+
+	public:
+		typedef T value_type;
+
+		template<typename U>
+		struct rebind
+		{
+			typedef arena_allocator<U> other;
+		};
+
+		/**
+		 * brief: constructor
+		 * param: the arena
+		 * return: --
+		 */
+		arena_allocator(arena& arena__) noexcept;
+
+		/**
+		 * brief: constructor from the allocator of another type
+		 * param: another arena_allocator
+		 * return: --
+		 */
+		template<typename U>
+		arena_allocator(const arena_allocator<U>& alloc) noexcept;
+
+		/**
+		 * brief: allocate n objects from the arena
+		 * param: the number of objects
+		 * return: T*
+		 */
+		inline T* allocate(size_t n);
+
+		/**
+		 * brief: do nothing (released by arena::reset())
+		 * param: the pointer, the number of objects
+		 * return: void
+		 */
+		inline void deallocate(T* ptr, size_t n) noexcept;
+
+		/**
+		 * brief: whether the arena has not been reset since bound
+		 * param: (void)
+		 * return: bool
+		 */
+		inline bool valid() const noexcept;
+
+		/**
+		 * brief: the arena bound to
+		 * param: (void)
+		 * return: arena*
+		 */
+		inline arena* resource() const noexcept;
+
+		template<typename U>
+		inline bool operator==(const arena_allocator<U>& alloc) const noexcept;
+		template<typename U>
+		inline bool operator!=(const arena_allocator<U>& alloc) const noexcept;
+	};
+
+	// nodes of lists bound to an arena are released by arena::reset()
+	template<typename T>
+	struct is_bulk_release_allocator<arena_allocator<T>> : std::true_type { };
+
+	// tvj::forward_list bound to a tvj::arena
+	template<typename Elem>
+	using arena_forward_list = forward_list<Elem, arena_allocator<Elem>>;
+
+	unsigned char* arena::_data(Chunk* chunk) noexcept
+	{
+		return reinterpret_cast<unsigned char*>(chunk + 1);
+	}
+
+	inline void arena::_grow(size_t bytes)
+	{
+		// reuse the next chunk if it is large enough
+		if (current && current->succ && current->succ->size >= bytes)
+		{
+			current = current->succ;
+			offset = 0;
+			return;
+		}
+		const size_t size = bytes > chunk_size ? bytes : chunk_size;
+		auto chunk = static_cast<Chunk*>(::operator new(sizeof(Chunk) + size));
+		chunk->size = size;
+		if (current)
+		{
+			chunk->succ = current->succ;
+			current->succ = chunk;
+		}
+		else
+		{
+			chunk->succ = first;
+			first = chunk;
+		}
+		current = chunk;
+		offset = 0;
+	}
+
+	inline arena::arena(size_t chunk_size_) : chunk_size(chunk_size_) { }
+
+	inline arena::~arena()
+	{
+		release();
+	}
+
+	inline void* arena::allocate(size_t bytes, size_t alignment)
+	{
+		if (current)
+		{
+			const auto base = reinterpret_cast<std::uintptr_t>(_data(current));
+			const auto aligned = (base + offset + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+			if (aligned + bytes <= base + current->size)
+			{
+				offset = aligned + bytes - base;
+				return reinterpret_cast<void*>(aligned);
+			}
+		}
+		_grow(bytes + alignment);
+		const auto base = reinterpret_cast<std::uintptr_t>(_data(current));
+		const auto aligned = (base + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+		offset = aligned + bytes - base;
+		return reinterpret_cast<void*>(aligned);
+	}
+
+	void arena::reset() noexcept
+	{
+		current = first;
+		offset = 0;
+		generation_++;
+	}
+
+	inline void arena::release() noexcept
+	{
+		while (first)
+		{
+			auto chunk = first;
+			first = first->succ;
+			::operator delete(chunk);
+		}
+		current = nullptr;
+		offset = 0;
+		generation_++;
+	}
+
+	size_t arena::generation() const noexcept
+	{
+		return generation_;
+	}
+
+	inline size_t arena::reserved() const noexcept
+	{
+		size_t bytes = 0;
+		for (auto chunk = first; chunk; chunk = chunk->succ) bytes += sizeof(Chunk) + chunk->size;
+		return bytes;
+	}
+
+	template<typename T>
+	arena_allocator<T>::arena_allocator(arena& arena__) noexcept : arena_(&arena__), generation_(arena__.generation()) { }
+
+	template<typename T> template<typename U>
+	arena_allocator<T>::arena_allocator(const arena_allocator<U>& alloc) noexcept : arena_(alloc.arena_), generation_(alloc.generation_) { }
+
+	template<typename T>
+	T* arena_allocator<T>::allocate(size_t n)
+	{
+#ifndef NDEBUG
+		if (!valid()) error_info("Allocation from tvj::arena_allocator after its arena was reset.", TVJ_FORWARD_LIST_DANGLING);
+#endif
+		return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+	}
+
+	template<typename T>
+	void arena_allocator<T>::deallocate(T*, size_t) noexcept { }
+
+	template<typename T>
+	bool arena_allocator<T>::valid() const noexcept
+	{
+		return arena_->generation() == generation_;
+	}
+
+	template<typename T>
+	arena* arena_allocator<T>::resource() const noexcept
+	{
+		return arena_;
+	}
+
+	template<typename T> template<typename U>
+	bool arena_allocator<T>::operator==(const arena_allocator<U>& alloc) const noexcept
+	{
+		return arena_ == alloc.arena_ && generation_ == alloc.generation_;
+	}
+
+	template<typename T> template<typename U>
+	bool arena_allocator<T>::operator!=(const arena_allocator<U>& alloc) const noexcept
+	{
+		return !(*this == alloc);
+	}
+};
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
@@ -0,0 +1,480 @@
+/*
+ * File: TVJ_Bounded_Queue.h
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+#include "TVJ_Forward_List.h"
+#include "TVJ_Node_Pool.h"
+
+namespace tvj
+{
+	// The bounded blocking FIFO queue shared by producer and consumer threads,
+	// the elements are kept in a singly linked chain whose nodes are recycled by a tvj::fixed_block_pool.
+	// A waiting thread first spins (spin_count times) on the size and then parks on a condition variable,
+	// which is only notified when some thread is parked on it.
+	// pop_many cuts a whole chain in one lock and moves the elements out of the lock.
+	template<typename Elem>
+	class bounded_queue
+	{
+	protected:
+		// the class of the queue node
+		struct Node
+		{
+			template<typename... Args>
+			Node(Args&&... args);
+			Node* succ = nullptr;
+			Elem  data; // the data the node contains
+		};
+
+		// construct a node from the pool (with the lock held)
+		template<typename... Args>
+		Node* _create_node(Args&&... args);
+
+		// destroy a node and return it to the pool (with the lock held)
+		void _destroy_node(Node* node) noexcept;
+
+		// link a node at the back (with the lock held)
+		inline void _link_back(Node* node) noexcept;
+
+		// spin until the condition holds or the spin count is used up
+		template<typename Pred>
+		void _spin(Pred pred) const;
+
+		// wait with the lock until there is room, return false if closed
+		bool _wait_room(std::unique_lock<std::mutex>& lock);
+
+		// wait with the lock until there is an element, return false if closed and empty
+		bool _wait_elem(std::unique_lock<std::mutex>& lock);
+
+	private:
+		mutable std::mutex      mutex;
+		std::condition_variable not_empty;
+		std::condition_variable not_full;
+		fixed_block_pool        pool;
+		Node*                   head = nullptr;
+		Node*                   tail = nullptr;
+		std::atomic<size_t>     size_;
+		std::atomic<bool>       closed_;
+		size_t                  capacity_;
+		unsigned                spin;
+		size_t                  push_waiters = 0; // the producers parked on not_full
+		size_t                  pop_waiters  = 0; // the consumers parked on not_empty
+
+	public:
+		/**
+		 * brief: constructor
+		 * param: the capacity (at least 1), the number of spins before parking
+		 * return: --
+		 */
+		explicit bounded_queue(size_t capacity, unsigned spin_count = 0);
+
+		bounded_queue(const bounded_queue&) = delete;
+		bounded_queue& operator=(const bounded_queue&) = delete;
+
+		/**
+		 * @brief: destructor, no thread may use the queue any more
+		 * @param: (void)
+		 * @return: --
+		 */
+		~bounded_queue();
+
+		/**
+		 * brief: push an element, wait while it is full
+		 * param: the element
+		 * return: bool (false if the queue is closed)
+		 */
+		inline bool push(const Elem& elem);
+
+		/**
+		 * brief: push an element, wait while it is full
+		 * param: the element (rvalue)
+		 * return: bool (false if the queue is closed)
+		 */
+		inline bool push(Elem&& elem);
+
+		/**
+		 * brief: construct an element at the back, wait while it is full
+		 * param: the arguments of the element constructor
+		 * return: bool (false if the queue is closed)
+		 */
+		template<typename... Args>
+		bool emplace(Args&&... args);
+
+		/**
+		 * brief: push an element without waiting
+		 * param: the element
+		 * return: bool (false if the queue is full or closed)
+		 */
+		template<typename E>
+		bool try_push(E&& elem);
+
+		/**
+		 * brief: push the elements of [first, last), waiting for room as needed,
+		 *        each lock pushes as many as there is room for
+		 * param: the first and last iterator
+		 * return: size_t (number of pushed elements, less if the queue is closed)
+		 */
+		template<typename _Iter>
+		size_t push_many(_Iter first, const _Iter& last);
+
+		/**
+		 * brief: pop the front element, wait while it is empty
+		 * param: the element to move to
+		 * return: bool (false if the queue is closed and empty)
+		 */
+		bool pop(Elem& elem);
+
+		/**
+		 * brief: pop the front element without waiting
+		 * param: the element to move to
+		 * return: bool (false if the queue is empty)
+		 */
+		bool try_pop(Elem& elem);
+
+		/**
+		 * brief: wait while it is empty and pop up to n elements at once,
+		 *        if writing to out throws, the elements not written yet are put back at the front
+		 * param: the output iterator, the max number of elements
+		 * return: size_t (number of popped elements, 0 if the queue is closed and empty)
+		 */
+		template<typename _OutIter>
+		size_t pop_many(_OutIter out, size_t n);
+
+		/**
+		 * brief: close the queue, waiting threads are woken up, pushes fail and pops drain the rest
+		 * param: (void)
+		 * return: void
+		 */
+		void close();
+
+		/**
+		 * brief: if the queue is closed
+		 * param: (void)
+		 * return: bool
+		 */
+		inline bool closed() const noexcept;
+
+		/**
+		 * brief: the number of elements (a snapshot)
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t size() const noexcept;
+
+		/**
+		 * brief: if the queue is empty (a snapshot)
+		 * param: (void)
+		 * return: bool
+		 */
+		inline bool empty() const noexcept;
+
+		/**
+		 * brief: the capacity
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t capacity() const noexcept;
+	};
+
+	template<typename Elem> template<typename... Args>
+	bounded_queue<Elem>::Node::Node(Args&&... args) : data(std::forward<Args>(args)...) { }
+
+	template<typename Elem> template<typename... Args>
+	typename bounded_queue<Elem>::Node* bounded_queue<Elem>::_create_node(Args&&... args)
+	{
+		void* ptr = pool.allocate(sizeof(Node), alignof(Node));
+		try
+		{
+			return ::new (ptr) Node(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			pool.deallocate(ptr);
+			throw;
+		}
+	}
+
+	template<typename Elem>
+	void bounded_queue<Elem>::_destroy_node(Node* node) noexcept
+	{
+		node->~Node();
+		pool.deallocate(node);
+	}
+
+	template<typename Elem>
+	void bounded_queue<Elem>::_link_back(Node* node) noexcept
+	{
+		if (tail) tail->succ = node;
+		else      head = node;
+		tail = node;
+		size_.store(size_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+	template<typename Elem> template<typename Pred>
+	void bounded_queue<Elem>::_spin(Pred pred) const
+	{
+		for (unsigned i = 0; i != spin && !pred(); i++) std::this_thread::yield();
+	}
+
+	template<typename Elem>
+	bool bounded_queue<Elem>::_wait_room(std::unique_lock<std::mutex>& lock)
+	{
+		// the size may exceed the capacity after a failed pop_many put its elements back
+		if (size_.load(std::memory_order_relaxed) >= capacity_ && !closed_.load(std::memory_order_relaxed))
+		{
+			push_waiters++;
+			not_full.wait(lock, [this] { return size_.load(std::memory_order_relaxed) < capacity_ || closed_.load(std::memory_order_relaxed); });
+			push_waiters--;
+		}
+		return !closed_.load(std::memory_order_relaxed);
+	}
+
+	template<typename Elem>
+	bool bounded_queue<Elem>::_wait_elem(std::unique_lock<std::mutex>& lock)
+	{
+		if (!head && !closed_.load(std::memory_order_relaxed))
+		{
+			pop_waiters++;
+			not_empty.wait(lock, [this] { return head || closed_.load(std::memory_order_relaxed); });
+			pop_waiters--;
+		}
+		return head != nullptr;
+	}
+
+	template<typename Elem>
+	bounded_queue<Elem>::bounded_queue(size_t capacity, unsigned spin_count)
+		: pool(capacity < 1024 ? capacity : 1024), size_(0), closed_(false), capacity_(capacity), spin(spin_count)
+	{
+#ifndef NDEBUG
+		if (!capacity) error_info("Zero capacity of tvj::bounded_queue.", TVJ_FORWARD_LIST_UNDERFLOW);
+#endif
+	}
+
+	template<typename Elem>
+	bounded_queue<Elem>::~bounded_queue()
+	{
+		while (head)
+		{
+			auto node = head;
+			head = head->succ;
+			_destroy_node(node);
+		}
+	}
+
+	template<typename Elem>
+	bool bounded_queue<Elem>::push(const Elem& elem)
+	{
+		return emplace(elem);
+	}
+
+	template<typename Elem>
+	bool bounded_queue<Elem>::push(Elem&& elem)
+	{
+		return emplace(std::move(elem));
+	}
+
+	template<typename Elem> template<typename... Args>
+	bool bounded_queue<Elem>::emplace(Args&&... args)
+	{
+		_spin([this] { return size_.load(std::memory_order_acquire) < capacity_ || closed_.load(std::memory_order_acquire); });
+		std::unique_lock<std::mutex> lock(mutex);
+		if (!_wait_room(lock)) return false;
+		_link_back(_create_node(std::forward<Args>(args)...));
+		const bool wake = pop_waiters;
+		lock.unlock();
+		if (wake) not_empty.notify_one();
+		return true;
+	}
+
+	template<typename Elem> template<typename E>
+	bool bounded_queue<Elem>::try_push(E&& elem)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		if (closed_.load(std::memory_order_relaxed) || size_.load(std::memory_order_relaxed) >= capacity_) return false;
+		_link_back(_create_node(std::forward<E>(elem)));
+		const bool wake = pop_waiters;
+		lock.unlock();
+		if (wake) not_empty.notify_one();
+		return true;
+	}
+
+	template<typename Elem> template<typename _Iter>
+	size_t bounded_queue<Elem>::push_many(_Iter first, const _Iter& last)
+	{
+		size_t pushed = 0;
+		while (first != last)
+		{
+			_spin([this] { return size_.load(std::memory_order_acquire) < capacity_ || closed_.load(std::memory_order_acquire); });
+			std::unique_lock<std::mutex> lock(mutex);
+			if (!_wait_room(lock)) break;
+			size_t room = capacity_ - size_.load(std::memory_order_relaxed);
+			try
+			{
+				for (; room && first != last; room--, ++first, pushed++) _link_back(_create_node(*first));
+			}
+			catch (...)
+			{
+				// the elements linked in this round are still there for the parked consumers
+				const bool wake = pop_waiters;
+				lock.unlock();
+				if (wake) not_empty.notify_all();
+				throw;
+			}
+			const bool wake = pop_waiters;
+			lock.unlock();
+			if (wake) not_empty.notify_all();
+		}
+		return pushed;
+	}
+
+	template<typename Elem>
+	bool bounded_queue<Elem>::pop(Elem& elem)
+	{
+		_spin([this] { return size_.load(std::memory_order_acquire) || closed_.load(std::memory_order_acquire); });
+		std::unique_lock<std::mutex> lock(mutex);
+		if (!_wait_elem(lock)) return false;
+		auto node = head;
+		elem = std::move(node->data);
+		head = node->succ;
+		if (!head) tail = nullptr;
+		size_.store(size_.load(std::memory_order_relaxed) - 1, std::memory_order_release);
+		_destroy_node(node);
+		const bool wake = push_waiters;
+		lock.unlock();
+		if (wake) not_full.notify_one();
+		return true;
+	}
+
+	template<typename Elem>
+	bool bounded_queue<Elem>::try_pop(Elem& elem)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		if (!head) return false;
+		auto node = head;
+		elem = std::move(node->data);
+		head = node->succ;
+		if (!head) tail = nullptr;
+		size_.store(size_.load(std::memory_order_relaxed) - 1, std::memory_order_release);
+		_destroy_node(node);
+		const bool wake = push_waiters;
+		lock.unlock();
+		if (wake) not_full.notify_one();
+		return true;
+	}
+
+	template<typename Elem> template<typename _OutIter>
+	size_t bounded_queue<Elem>::pop_many(_OutIter out, size_t n)
+	{
+		if (!n) return 0;
+		_spin([this] { return size_.load(std::memory_order_acquire) || closed_.load(std::memory_order_acquire); });
+		std::unique_lock<std::mutex> lock(mutex);
+		if (!_wait_elem(lock)) return 0;
+
+		// cut the first n nodes as one chain
+		auto first = head;
+		auto last = head;
+		size_t count = 1;
+		while (count != n && last->succ)
+		{
+			last = last->succ;
+			count++;
+		}
+		head = last->succ;
+		if (!head) tail = nullptr;
+		last->succ = nullptr;
+		size_.store(size_.load(std::memory_order_relaxed) - count, std::memory_order_release);
+		const bool wake = push_waiters;
+		lock.unlock();
+		if (wake) not_full.notify_all();
+
+		// move the elements out of the lock, then return the nodes in one lock
+		auto node = first;
+		size_t moved = 0;
+		try
+		{
+			for (; node; node = node->succ, moved++) *out++ = std::move(node->data);
+		}
+		catch (...)
+		{
+			// the elements not moved out go back to the front (the size may exceed the capacity for a while)
+			lock.lock();
+			while (first != node)
+			{
+				auto done = first;
+				first = first->succ;
+				_destroy_node(done);
+			}
+			last->succ = head;
+			head = node;
+			if (!tail) tail = last;
+			size_.store(size_.load(std::memory_order_relaxed) + count - moved, std::memory_order_release);
+			const bool wake_pop = pop_waiters;
+			lock.unlock();
+			if (wake_pop) not_empty.notify_all();
+			throw;
+		}
+		lock.lock();
+		while (first)
+		{
+			node = first;
+			first = first->succ;
+			_destroy_node(node);
+		}
+		return count;
+	}
+
+	template<typename Elem>
+	void bounded_queue<Elem>::close()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			closed_.store(true, std::memory_order_release);
+		}
+		not_empty.notify_all();
+		not_full.notify_all();
+	}
+
+	template<typename Elem>
+	bool bounded_queue<Elem>::closed() const noexcept
+	{
+		return closed_.load(std::memory_order_acquire);
+	}
+
+	template<typename Elem>
+	size_t bounded_queue<Elem>::size() const noexcept
+	{
+		return size_.load(std::memory_order_acquire);
+	}
+
+	template<typename Elem>
+	bool bounded_queue<Elem>::empty() const noexcept
+	{
+		return !size();
+	}
+
+	template<typename Elem>
+	size_t bounded_queue<Elem>::capacity() const noexcept
+	{
+		return capacity_;
+	}
+};
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
@@ -0,0 +1,690 @@
+/*
+ * File: TVJ_Chunked_Queue.h
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "TVJ_Forward_List.h"
+
+namespace tvj
+{
+	// The tvj::chunked_queue class
+	// that keeps the elements in fixed-size arrays (chunks) linked by a singly linked spine,
+	// elements are appended at the back and consumed from the front, and never move once constructed.
+	// Each chunk holds the range [first, last) of its slots in use, so whole chunks can be spliced
+	// between queues without filling the gaps.
+	template<typename Elem, size_t ChunkSize = 64, typename Alloc = std::allocator<Elem>>
+	class chunked_queue
+	{
+		static_assert(ChunkSize > 0, "Zero chunk size of tvj::chunked_queue.");
+
+	protected:
+		// the class of the chunk
+		struct Chunk
+		{
+			Chunk* succ  = nullptr;
+			size_t first = 0; // the first slot in use
+			size_t last  = 0; // the slot after the last one in use
+			typename std::aligned_storage<sizeof(Elem), alignof(Elem)>::type slots[ChunkSize];
+
+			inline Elem* data(size_t i) noexcept;
+		};
+
+	public:
+		typedef Alloc allocator_type;
+
+	protected:
+		typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Chunk> chunk_allocator;
+		typedef std::allocator_traits<chunk_allocator> chunk_traits;
+
+		// the allocator (empty base) and the spine
+		struct Spine : chunk_allocator
+		{
+			Spine(const chunk_allocator& alloc);
+			Chunk* head  = nullptr; // the first chunk
+			Chunk* tail  = nullptr; // the last chunk
+			Chunk* spare = nullptr; // one empty chunk kept for the next push_back
+		};
+
+		// take the spare chunk or allocate one
+		Chunk* _create_chunk();
+
+		// keep an empty chunk as the spare or deallocate it
+		void _destroy_chunk(Chunk* chunk) noexcept;
+
+		// unlink the first chunk after its last element is popped
+		inline void _pop_chunk() noexcept;
+
+		// deallocate the spare chunk
+		void _release_spare() noexcept;
+
+	private:
+		Spine  spine;
+		size_t size_ = 0;
+
+	public:
+		class const_iterator
+		{
+			friend class chunked_queue<Elem, ChunkSize, Alloc>;
+
+		protected:
+			Chunk* chunk;
+			size_t index;
+
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef Elem                      value_type;
+			typedef std::ptrdiff_t            difference_type;
+			typedef const Elem*               pointer;
+			typedef const Elem&               reference;
+
+			const_iterator(Chunk* chunk_ = nullptr, size_t index_ = 0) noexcept;
+		public:
+			inline const Elem& operator*() const;
+			inline const Elem* operator->() const;
+			inline const_iterator& operator++();
+			inline const_iterator operator++(int);
+			inline bool operator==(const const_iterator& iter) const noexcept;
+			inline bool operator!=(const const_iterator& iter) const noexcept;
+		};
+
+		class iterator : public const_iterator
+		{
+		public:
+			typedef Elem* pointer;
+			typedef Elem& reference;
+
+			// constructor declaration
+			using const_iterator::const_iterator;
+			inline Elem& operator*() const;
+			inline Elem* operator->() const;
+			inline iterator& operator++();
+			inline iterator operator++(int);
+		};
+
+		/**
+		 * brief: constructor for empty queue
+		 * param: the allocator
+		 * return: --
+		 */
+		explicit chunked_queue(const Alloc& alloc = Alloc());
+
+		/**
+		 * brief: copy constructor (the allocator is selected by select_on_container_copy_construction)
+		 * param: another queue
+		 * return: --
+		 */
+		chunked_queue(const chunked_queue& queue);
+
+		/**
+		 * brief: move constructor (the allocator is moved with the chunks)
+		 * param: another queue
+		 * return: --
+		 */
+		chunked_queue(chunked_queue&& queue) noexcept;
+
+		/**
+		 * @brief: destructor
+		 * @param: (void)
+		 * @return: --
+		 */
+		~chunked_queue();
+
+		/**
+		 * brief: copy assignment (the allocator is kept)
+		 * param: another queue
+		 * return: chunked_queue&
+		 */
+		chunked_queue& operator=(const chunked_queue& queue);
+
+		/**
+		 * brief: move assignment, the chunks are taken if the allocators are equal,
+		 *        otherwise the elements are moved one by one
+		 * param: another queue
+		 * return: chunked_queue&
+		 */
+		chunked_queue& operator=(chunked_queue&& queue);
+
+		/**
+		 * brief: exchange the chunks with another queue (the allocators must be equal)
+		 * param: another queue
+		 * return: void
+		 */
+		void swap(chunked_queue& queue) noexcept;
+
+		/**
+		 * brief: the allocator of the queue
+		 * param: (void)
+		 * return: allocator_type
+		 */
+		inline allocator_type get_allocator() const;
+
+		/**
+		 * brief: append an element
+		 * param: the element
+		 * return: void
+		 */
+		inline void push_back(const Elem& elem);
+
+		/**
+		 * brief: append an element
+		 * param: the element (rvalue)
+		 * return: void
+		 */
+		inline void push_back(Elem&& elem);
+
+		/**
+		 * brief: construct an element at the back
+		 * param: the arguments of the element constructor
+		 * return: Elem& (the new element)
+		 */
+		template<typename... Args>
+		Elem& emplace_back(Args&&... args);
+
+		/**
+		 * brief: remove the first element
+		 * param: (void)
+		 * return: void
+		 */
+		void pop_front();
+
+		/**
+		 * brief: pass up to n elements from the front to the function and remove them,
+		 *        emptied chunks are released as a whole
+		 * param: the function called with Elem&, the max number of elements
+		 * return: size_t (number of removed elements)
+		 */
+		template<typename Function>
+		size_t drain(Function fn, size_t n = size_t(-1));
+
+		/**
+		 * brief: move all chunks of another queue to the back in O(1) (the allocators must be equal),
+		 *        the addresses of the elements do not change
+		 * param: another queue
+		 * return: void
+		 */
+		void splice_back(chunked_queue& queue);
+
+		/**
+		 * brief: visit the elements from the front, looping over the array of each chunk
+		 * param: the function called with Elem&
+		 * return: void
+		 */
+		template<typename Function>
+		void for_each(Function fn);
+
+		/**
+		 * brief: the first element
+		 * param: (void)
+		 * return: Elem&
+		 */
+		inline Elem& front();
+
+		/**
+		 * brief: the first element
+		 * param: (void)
+		 * return: const Elem&
+		 */
+		inline const Elem& front() const;
+
+		/**
+		 * brief: the last element
+		 * param: (void)
+		 * return: Elem&
+		 */
+		inline Elem& back();
+
+		/**
+		 * brief: the last element
+		 * param: (void)
+		 * return: const Elem&
+		 */
+		inline const Elem& back() const;
+
+		/**
+		 * brief: remove all elements
+		 * param: (void)
+		 * return: void
+		 */
+		void clear() noexcept;
+
+		/**
+		 * brief: the number of elements
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t size() const noexcept;
+
+		/**
+		 * brief: if the queue is empty
+		 * param: (void)
+		 * return: bool
+		 */
+		inline bool empty() const noexcept;
+
+		inline iterator begin() noexcept;
+		inline iterator end() noexcept;
+		inline const_iterator begin() const noexcept;
+		inline const_iterator end() const noexcept;
+		inline const_iterator cbegin() const noexcept;
+		inline const_iterator cend() const noexcept;
+	};
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	Elem* chunked_queue<Elem, ChunkSize, Alloc>::Chunk::data(size_t i) noexcept
+	{
+		return reinterpret_cast<Elem*>(&slots[i]);
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	chunked_queue<Elem, ChunkSize, Alloc>::Spine::Spine(const chunk_allocator& alloc) : chunk_allocator(alloc) { }
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	typename chunked_queue<Elem, ChunkSize, Alloc>::Chunk* chunked_queue<Elem, ChunkSize, Alloc>::_create_chunk()
+	{
+		Chunk* chunk = spine.spare;
+		if (chunk) spine.spare = nullptr;
+		else
+		{
+			chunk_allocator& alloc = spine;
+			chunk = chunk_traits::allocate(alloc, 1);
+			chunk_traits::construct(alloc, chunk);
+		}
+		return chunk;
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	void chunked_queue<Elem, ChunkSize, Alloc>::_destroy_chunk(Chunk* chunk) noexcept
+	{
+		if (!spine.spare)
+		{
+			chunk->succ = nullptr;
+			chunk->first = chunk->last = 0;
+			spine.spare = chunk;
+			return;
+		}
+		chunk_allocator& alloc = spine;
+		chunk_traits::destroy(alloc, chunk);
+		chunk_traits::deallocate(alloc, chunk, 1);
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	void chunked_queue<Elem, ChunkSize, Alloc>::_pop_chunk() noexcept
+	{
+		auto chunk = spine.head;
+		spine.head = chunk->succ;
+		if (!spine.head) spine.tail = nullptr;
+		_destroy_chunk(chunk);
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	void chunked_queue<Elem, ChunkSize, Alloc>::_release_spare() noexcept
+	{
+		if (!spine.spare) return;
+		chunk_allocator& alloc = spine;
+		chunk_traits::destroy(alloc, spine.spare);
+		chunk_traits::deallocate(alloc, spine.spare, 1);
+		spine.spare = nullptr;
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	chunked_queue<Elem, ChunkSize, Alloc>::const_iterator::const_iterator(Chunk* chunk_, size_t index_) noexcept : chunk(chunk_), index(index_) { }
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	const Elem& chunked_queue<Elem, ChunkSize, Alloc>::const_iterator::operator*() const
+	{
+#ifndef NDEBUG
+		if (!chunk) error_info("Dereference of end() of tvj::chunked_queue.", TVJ_FORWARD_LIST_NULLPTR);
+#endif
+		return *chunk->data(index);
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	const Elem* chunked_queue<Elem, ChunkSize, Alloc>::const_iterator::operator->() const
+	{
+		return &**this;
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	typename chunked_queue<Elem, ChunkSize, Alloc>::const_iterator& chunked_queue<Elem, ChunkSize, Alloc>::const_iterator::operator++()
+	{
+#ifndef NDEBUG
+		if (!chunk) error_info("Increment of end() of tvj::chunked_queue.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		if (++index == chunk->last)
+		{
+			// the chunks in a queue are never empty
+			chunk = chunk->succ;
+			index = chunk ? chunk->first : 0;
+		}
+		return *this;
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	typename chunked_queue<Elem, ChunkSize, Alloc>::const_iterator chunked_queue<Elem, ChunkSize, Alloc>::const_iterator::operator++(int)
+	{
+		auto ret = *this;
+		++*this;
+		return ret;
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	bool chunked_queue<Elem, ChunkSize, Alloc>::const_iterator::operator==(const const_iterator& iter) const noexcept
+	{
+		return chunk == iter.chunk && index == iter.index;
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	bool chunked_queue<Elem, ChunkSize, Alloc>::const_iterator::operator!=(const const_iterator& iter) const noexcept
+	{
+		return !(*this == iter);
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	Elem& chunked_queue<Elem, ChunkSize, Alloc>::iterator::operator*() const
+	{
+		return const_cast<Elem&>(const_iterator::operator*());
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	Elem* chunked_queue<Elem, ChunkSize, Alloc>::iterator::operator->() const
+	{
+		return &**this;
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	typename chunked_queue<Elem, ChunkSize, Alloc>::iterator& chunked_queue<Elem, ChunkSize, Alloc>::iterator::operator++()
+	{
+		const_iterator::operator++();
+		return *this;
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	typename chunked_queue<Elem, ChunkSize, Alloc>::iterator chunked_queue<Elem, ChunkSize, Alloc>::iterator::operator++(int)
+	{
+		auto ret = *this;
+		++*this;
+		return ret;
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	chunked_queue<Elem, ChunkSize, Alloc>::chunked_queue(const Alloc& alloc) : spine(chunk_allocator(alloc)) { }
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	chunked_queue<Elem, ChunkSize, Alloc>::chunked_queue(const chunked_queue& queue)
+		: spine(chunk_traits::select_on_container_copy_construction(queue.spine))
+	{
+		try
+		{
+			for (auto& elem : queue) push_back(elem);
+		}
+		catch (...)
+		{
+			clear();
+			_release_spare();
+			throw;
+		}
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	chunked_queue<Elem, ChunkSize, Alloc>::chunked_queue(chunked_queue&& queue) noexcept : spine(std::move(static_cast<chunk_allocator&>(queue.spine)))
+	{
+		swap(queue);
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	chunked_queue<Elem, ChunkSize, Alloc>::~chunked_queue()
+	{
+		clear();
+		_release_spare();
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	chunked_queue<Elem, ChunkSize, Alloc>& chunked_queue<Elem, ChunkSize, Alloc>::operator=(const chunked_queue& queue)
+	{
+		if (&queue == this) return *this;
+		clear();
+		for (auto& elem : queue) push_back(elem);
+		return *this;
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	chunked_queue<Elem, ChunkSize, Alloc>& chunked_queue<Elem, ChunkSize, Alloc>::operator=(chunked_queue&& queue)
+	{
+		if (&queue == this) return *this;
+		clear();
+		if (static_cast<chunk_allocator&>(spine) == static_cast<chunk_allocator&>(queue.spine))
+		{
+			swap(queue);
+			return *this;
+		}
+		for (auto& elem : queue) push_back(std::move(elem));
+		queue.clear();
+		return *this;
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	void chunked_queue<Elem, ChunkSize, Alloc>::swap(chunked_queue& queue) noexcept
+	{
+		std::swap(spine.head, queue.spine.head);
+		std::swap(spine.tail, queue.spine.tail);
+		std::swap(spine.spare, queue.spine.spare);
+		std::swap(size_, queue.size_);
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	typename chunked_queue<Elem, ChunkSize, Alloc>::allocator_type chunked_queue<Elem, ChunkSize, Alloc>::get_allocator() const
+	{
+		return allocator_type(static_cast<const chunk_allocator&>(spine));
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	void chunked_queue<Elem, ChunkSize, Alloc>::push_back(const Elem& elem)
+	{
+		emplace_back(elem);
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	void chunked_queue<Elem, ChunkSize, Alloc>::push_back(Elem&& elem)
+	{
+		emplace_back(std::move(elem));
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc> template<typename... Args>
+	Elem& chunked_queue<Elem, ChunkSize, Alloc>::emplace_back(Args&&... args)
+	{
+		auto chunk = spine.tail;
+		if (!chunk || chunk->last == ChunkSize)
+		{
+			chunk = _create_chunk();
+			try
+			{
+				::new (static_cast<void*>(chunk->data(0))) Elem(std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				_destroy_chunk(chunk);
+				throw;
+			}
+			chunk->last = 1;
+			if (spine.tail) spine.tail->succ = chunk;
+			else            spine.head = chunk;
+			spine.tail = chunk;
+		}
+		else
+		{
+			::new (static_cast<void*>(chunk->data(chunk->last))) Elem(std::forward<Args>(args)...);
+			chunk->last++;
+		}
+		size_++;
+		return *chunk->data(chunk->last - 1);
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	void chunked_queue<Elem, ChunkSize, Alloc>::pop_front()
+	{
+#ifndef NDEBUG
+		if (!size_) error_info("Pop from an empty tvj::chunked_queue.", TVJ_FORWARD_LIST_UNDERFLOW);
+#endif
+		auto chunk = spine.head;
+		chunk->data(chunk->first)->~Elem();
+		if (++chunk->first == chunk->last) _pop_chunk();
+		size_--;
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc> template<typename Function>
+	size_t chunked_queue<Elem, ChunkSize, Alloc>::drain(Function fn, size_t n)
+	{
+		size_t drained = 0;
+		while (drained != n && spine.head)
+		{
+			auto chunk = spine.head;
+			// the elements are popped one by one only in case fn throws
+			while (drained != n && chunk->first != chunk->last)
+			{
+				auto elem = chunk->data(chunk->first);
+				fn(*elem);
+				elem->~Elem();
+				chunk->first++;
+				size_--;
+				drained++;
+			}
+			if (chunk->first == chunk->last) _pop_chunk();
+		}
+		return drained;
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	void chunked_queue<Elem, ChunkSize, Alloc>::splice_back(chunked_queue& queue)
+	{
+		if (&queue == this || !queue.spine.head) return;
+#ifndef NDEBUG
+		if (static_cast<chunk_allocator&>(spine) != static_cast<chunk_allocator&>(queue.spine))
+			error_info("Splice of tvj::chunked_queue with different allocators.", TVJ_FORWARD_LIST_TYPE_MISMATCH);
+#endif
+		if (spine.tail) spine.tail->succ = queue.spine.head;
+		else            spine.head = queue.spine.head;
+		spine.tail = queue.spine.tail;
+		size_ += queue.size_;
+		queue.spine.head = queue.spine.tail = nullptr;
+		queue.size_ = 0;
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc> template<typename Function>
+	void chunked_queue<Elem, ChunkSize, Alloc>::for_each(Function fn)
+	{
+		for (auto chunk = spine.head; chunk; chunk = chunk->succ)
+		{
+			auto first = chunk->data(chunk->first), last = chunk->data(0) + chunk->last;
+			for (; first != last; ++first) fn(*first);
+		}
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	Elem& chunked_queue<Elem, ChunkSize, Alloc>::front()
+	{
+		return const_cast<Elem&>(static_cast<const chunked_queue*>(this)->front());
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	const Elem& chunked_queue<Elem, ChunkSize, Alloc>::front() const
+	{
+#ifndef NDEBUG
+		if (!size_) error_info("Front of an empty tvj::chunked_queue.", TVJ_FORWARD_LIST_UNDERFLOW);
+#endif
+		return *spine.head->data(spine.head->first);
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	Elem& chunked_queue<Elem, ChunkSize, Alloc>::back()
+	{
+		return const_cast<Elem&>(static_cast<const chunked_queue*>(this)->back());
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	const Elem& chunked_queue<Elem, ChunkSize, Alloc>::back() const
+	{
+#ifndef NDEBUG
+		if (!size_) error_info("Back of an empty tvj::chunked_queue.", TVJ_FORWARD_LIST_UNDERFLOW);
+#endif
+		return *spine.tail->data(spine.tail->last - 1);
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	void chunked_queue<Elem, ChunkSize, Alloc>::clear() noexcept
+	{
+		while (spine.head)
+		{
+			auto chunk = spine.head;
+			for (auto i = chunk->first; i != chunk->last; i++) chunk->data(i)->~Elem();
+			_pop_chunk();
+		}
+		size_ = 0;
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	size_t chunked_queue<Elem, ChunkSize, Alloc>::size() const noexcept
+	{
+		return size_;
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	bool chunked_queue<Elem, ChunkSize, Alloc>::empty() const noexcept
+	{
+		return !size_;
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	typename chunked_queue<Elem, ChunkSize, Alloc>::iterator chunked_queue<Elem, ChunkSize, Alloc>::begin() noexcept
+	{
+		return iterator(spine.head, spine.head ? spine.head->first : 0);
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	typename chunked_queue<Elem, ChunkSize, Alloc>::iterator chunked_queue<Elem, ChunkSize, Alloc>::end() noexcept
+	{
+		return iterator(nullptr, 0);
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	typename chunked_queue<Elem, ChunkSize, Alloc>::const_iterator chunked_queue<Elem, ChunkSize, Alloc>::begin() const noexcept
+	{
+		return const_iterator(spine.head, spine.head ? spine.head->first : 0);
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	typename chunked_queue<Elem, ChunkSize, Alloc>::const_iterator chunked_queue<Elem, ChunkSize, Alloc>::end() const noexcept
+	{
+		return const_iterator(nullptr, 0);
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	typename chunked_queue<Elem, ChunkSize, Alloc>::const_iterator chunked_queue<Elem, ChunkSize, Alloc>::cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	template<typename Elem, size_t ChunkSize, typename Alloc>
+	typename chunked_queue<Elem, ChunkSize, Alloc>::const_iterator chunked_queue<Elem, ChunkSize, Alloc>::cend() const noexcept
+	{
+		return end();
+	}
+};
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
@@ -0,0 +1,853 @@
+/*
+ * File: TVJ_Compressed_List.h
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "TVJ_Forward_List.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#define TVJ_OFFSET_ARENA_MMAP
+#endif
+
+namespace tvj
+{
+	// The bounded arena of one contiguous region whose addresses can be stored as 32-bit offsets,
+	// an offset counts units (the allocation granularity) from the base and 0 stands for nullptr,
+	// so at most 4G units (32 GiB with 8-byte units) can be addressed.
+	// Deallocated blocks of up to max_free_units units are kept in free lists shared by all users,
+	// they are chained by the offset stored at their start.
+	class offset_arena
+	{
+	public:
+		static constexpr size_t max_free_units = 64;
+
+	private:
+		unsigned char* base = nullptr;
+		size_t capacity_;
+		size_t unit_;
+		size_t used_;
+		bool   mapped = false; // reserved by mmap rather than ::operator new
+		uint32_t free_lists[max_free_units + 1] = {}; // the first free block of each size in units
+
+		// the size of a block in units (at least the size of an offset)
+		inline size_t _units(size_t bytes) const noexcept;
+
+	public:
+		/**
+		 * brief: constructor, the region is reserved at once (committed lazily by the system when mmap is available)
+		 * param: the capacity in bytes (limited to 4G units), the unit in bytes (a power of 2)
+		 * return: --
+		 */
+		explicit offset_arena(size_t capacity = size_t(1) << 30, size_t unit = 8);
+
+		offset_arena(const offset_arena&) = delete;
+		offset_arena& operator=(const offset_arena&) = delete;
+
+		/**
+		 * brief: destructor, the region is returned to the system
+		 * param: (void)
+		 * return: --
+		 */
+		~offset_arena();
+
+		/**
+		 * brief: allocate memory aligned to the unit from the free list of its size or by bumping,
+		 *        std::bad_alloc is thrown when the region is full
+		 * param: the size in bytes
+		 * return: void*
+		 */
+		void* allocate(size_t bytes);
+
+		/**
+		 * brief: return a block to the free list of its size (larger blocks are only released by reset())
+		 * param: the block, its size in bytes
+		 * return: void
+		 */
+		inline void deallocate(void* ptr, size_t bytes) noexcept;
+
+		/**
+		 * brief: return a chain of blocks of the same size in O(1),
+		 *        each block starts with the offset of the next one and the last one is given
+		 * param: the offsets of the first and the last block, their size in bytes
+		 * return: void
+		 */
+		inline void deallocate_chain(uint32_t first, uint32_t last, size_t bytes) noexcept;
+
+		/**
+		 * brief: the offset of an address in the region (0 for nullptr)
+		 * param: the address
+		 * return: uint32_t
+		 */
+		inline uint32_t compress(const void* ptr) const noexcept;
+
+		/**
+		 * brief: the address of an offset (nullptr for 0)
+		 * param: the offset
+		 * return: void*
+		 */
+		inline void* decompress(uint32_t offset) const noexcept;
+
+		/**
+		 * brief: drop all the memory allocated and the free lists in O(1), lists bound to the arena must not be used afterwards
+		 * param: (void)
+		 * return: void
+		 */
+		inline void reset() noexcept;
+
+		/**
+		 * brief: the allocation granularity in bytes
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t unit() const noexcept;
+
+		/**
+		 * brief: the bytes carved from the region (including the blocks in the free lists)
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t used() const noexcept;
+
+		/**
+		 * brief: the bytes reserved
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t capacity() const noexcept;
+	};
+
+	// The tvj::compressed_forward_list class
+	// whose nodes live in a tvj::offset_arena and are linked by 32-bit offsets instead of pointers,
+	// iterators decompress the offsets when they are dereferenced or incremented.
+	// Erased nodes and destroyed lists go back to the free lists of the arena for any list to reuse,
+	// and the head sentinel is only allocated on the first insertion.
+	template<typename Elem>
+	class compressed_forward_list
+	{
+	protected:
+		// the link of a node (the head sentinel only has the link)
+		struct Link
+		{
+			uint32_t succ = 0;
+		};
+
+		// the class of the list node
+		struct Node : Link
+		{
+			template<typename... Args>
+			Node(Args&&... args);
+			Elem data; // the data the node contains
+		};
+
+		// the address of an offset
+		inline Link* _link(uint32_t offset) const noexcept;
+
+		// the element of a node offset
+		inline Elem& _data(uint32_t offset) const noexcept;
+
+		// construct a node from the arena and return its offset
+		template<typename... Args>
+		uint32_t _create_node(Args&&... args);
+
+		// destroy a node and return it to the arena
+		void _destroy_node(uint32_t offset) noexcept;
+
+		// allocate the head sentinel if the list has none yet
+		inline void _ensure_head();
+
+	private:
+		offset_arena* arena;
+		uint32_t head = 0;       // the offset of the head sentinel (0 until the first insertion)
+		uint32_t tail = 0;       // the offset of the last node (head if empty)
+		size_t   size_ = 0;
+
+	public:
+		class const_iterator
+		{
+			friend class compressed_forward_list<Elem>;
+
+		protected:
+			const offset_arena* arena;
+			uint32_t node;
+
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef Elem                      value_type;
+			typedef std::ptrdiff_t            difference_type;
+			typedef const Elem*               pointer;
+			typedef const Elem&               reference;
+
+			const_iterator(const offset_arena* arena_ = nullptr, uint32_t node_ = 0) noexcept;
+		public:
+			inline const Elem& operator*() const;
+			inline const Elem* operator->() const;
+			inline const_iterator& operator++();
+			inline const_iterator operator++(int);
+			inline bool operator==(const const_iterator& iter) const noexcept;
+			inline bool operator!=(const const_iterator& iter) const noexcept;
+		};
+
+		class iterator : public const_iterator
+		{
+		public:
+			typedef Elem* pointer;
+			typedef Elem& reference;
+
+			// constructor declaration
+			using const_iterator::const_iterator;
+			inline Elem& operator*() const;
+			inline Elem* operator->() const;
+			inline iterator& operator++();
+			inline iterator operator++(int);
+		};
+
+		/**
+		 * brief: constructor for empty list bound to the arena
+		 * param: the arena
+		 * return: --
+		 */
+		explicit compressed_forward_list(offset_arena& arena_);
+
+		/**
+		 * brief: copy constructor (bound to the same arena)
+		 * param: another list
+		 * return: --
+		 */
+		compressed_forward_list(const compressed_forward_list& list_);
+
+		/**
+		 * brief: move constructor, the nodes are taken and list_ is left without a sentinel
+		 * param: another list
+		 * return: --
+		 */
+		compressed_forward_list(compressed_forward_list&& list_) noexcept;
+
+		/**
+		 * @brief: destructor, the elements are destroyed and the nodes and the sentinel are returned to the arena
+		 * @param: (void)
+		 * @return: --
+		 */
+		~compressed_forward_list();
+
+		/**
+		 * brief: copy assignment
+		 * param: another list
+		 * return: compressed_forward_list&
+		 */
+		compressed_forward_list& operator=(const compressed_forward_list& list_);
+
+		/**
+		 * brief: the size of a node in bytes
+		 * param: (void)
+		 * return: size_t
+		 */
+		static constexpr size_t node_size() noexcept;
+
+		/**
+		 * brief: clear all elements in the list (the nodes are recycled)
+		 * param: (void)
+		 * return: void
+		 */
+		void clear() noexcept;
+
+		/**
+		 * brief: the size (valid element number)
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t size() const noexcept;
+
+		/**
+		 * brief: if the list is empty
+		 * param: (void)
+		 * return: bool
+		 */
+		inline bool empty() const noexcept;
+
+		/**
+		 * brief: the iterator before begin() (the sentinel is allocated if the list has none yet)
+		 * param: (void)
+		 * return: iterator
+		 */
+		inline iterator before_begin();
+
+		/**
+		 * brief: the iterator begin()
+		 * param: (void)
+		 * return: iterator
+		 */
+		inline iterator begin() noexcept;
+
+		/**
+		 * brief: the iterator back() that is the last valid element
+		 * param: (void)
+		 * return: iterator
+		 */
+		inline iterator back() noexcept;
+
+		/**
+		 * brief: the iterator end() that is one past the last element
+		 * param: (void)
+		 * return: iterator
+		 */
+		inline iterator end() noexcept;
+
+		/**
+		 * brief: the iterator before begin() (end() if the list has no sentinel yet)
+		 * param: (void)
+		 * return: const_iterator
+		 */
+		inline const_iterator before_begin() const noexcept;
+
+		/**
+		 * brief: the iterator begin()
+		 * param: (void)
+		 * return: const_iterator
+		 */
+		inline const_iterator begin() const noexcept;
+
+		/**
+		 * brief: the iterator back() that is the last valid element
+		 * param: (void)
+		 * return: const_iterator
+		 */
+		inline const_iterator back() const noexcept;
+
+		/**
+		 * brief: the iterator end() that is one past the last element
+		 * param: (void)
+		 * return: const_iterator
+		 */
+		inline const_iterator end() const noexcept;
+
+		/**
+		 * brief: find the element and return its iterator of first occurence,
+		 *        if no result found, return end()
+		 * param: the element type
+		 * return: const_iterator
+		 */
+		const_iterator find(const Elem& elem) const noexcept;
+
+		/**
+		 * brief: insert a new element before the first element
+		 * param: the element type
+		 * return: void
+		 */
+		inline void push_front(const Elem& elem);
+
+		/**
+		 * brief: insert a new element at the end
+		 * param: the element type
+		 * return: void
+		 */
+		inline void push_back(const Elem& elem);
+
+		/**
+		 * brief: remove the first element
+		 * param: (void)
+		 * return: void
+		 */
+		inline void pop_front();
+
+		/**
+		 * brief: insert a new element after the iterator
+		 * param: the iterator and the element
+		 * return: iterator (the new element)
+		 */
+		iterator insert_after(const const_iterator& iter, const Elem& elem);
+
+		/**
+		 * brief: erase the element after the iterator
+		 * param: the iterator
+		 * return: iterator (the one after the erased element)
+		 */
+		iterator erase_after(const const_iterator& iter);
+
+		/**
+		 * brief: remove the elements satisfying the predicate
+		 * param: the predicate
+		 * return: size_t (number of removed elements)
+		 */
+		template<typename Predicate>
+		size_t remove_if(Predicate pred);
+
+		/**
+		 * brief: reverse the list by relinking the nodes
+		 * param: (void)
+		 * return: void
+		 */
+		void reverse() noexcept;
+	};
+
+	inline offset_arena::offset_arena(size_t capacity, size_t unit) : unit_(unit), used_(unit)
+	{
+#ifndef NDEBUG
+		if (!unit || (unit & (unit - 1)) || unit > alignof(std::max_align_t))
+			error_info("The unit of tvj::offset_arena is not a power of 2 up to the max alignment.", TVJ_FORWARD_LIST_TYPE_MISMATCH);
+#endif
+		// offset 0 (the first unit) is never allocated so that it stands for nullptr
+		const size_t max_capacity = unit * size_t(UINT32_MAX);
+		capacity_ = (capacity < max_capacity ? capacity : max_capacity) / unit * unit;
+		if (capacity_ < 2 * unit) capacity_ = 2 * unit;
+#ifdef TVJ_OFFSET_ARENA_MMAP
+#ifdef MAP_NORESERVE
+		auto ptr = mmap(nullptr, capacity_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+#else
+		auto ptr = mmap(nullptr, capacity_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+#endif
+		if (ptr != MAP_FAILED)
+		{
+			base = static_cast<unsigned char*>(ptr);
+			mapped = true;
+		}
+#endif
+		if (!base) base = static_cast<unsigned char*>(::operator new(capacity_));
+	}
+
+	inline offset_arena::~offset_arena()
+	{
+#ifdef TVJ_OFFSET_ARENA_MMAP
+		if (mapped)
+		{
+			munmap(base, capacity_);
+			return;
+		}
+#endif
+		::operator delete(base);
+	}
+
+	size_t offset_arena::_units(size_t bytes) const noexcept
+	{
+		return ((bytes < sizeof(uint32_t) ? sizeof(uint32_t) : bytes) + unit_ - 1) / unit_;
+	}
+
+	inline void* offset_arena::allocate(size_t bytes)
+	{
+		const size_t units = _units(bytes);
+		if (units <= max_free_units && free_lists[units])
+		{
+			auto ptr = decompress(free_lists[units]);
+			std::memcpy(&free_lists[units], ptr, sizeof(uint32_t));
+			return ptr;
+		}
+		const size_t size = units * unit_;
+		if (size > capacity_ - used_) throw std::bad_alloc();
+		auto ptr = base + used_;
+		used_ += size;
+		return ptr;
+	}
+
+	void offset_arena::deallocate(void* ptr, size_t bytes) noexcept
+	{
+		const auto offset = compress(ptr);
+		deallocate_chain(offset, offset, bytes);
+	}
+
+	void offset_arena::deallocate_chain(uint32_t first, uint32_t last, size_t bytes) noexcept
+	{
+		const size_t units = _units(bytes);
+		if (units > max_free_units) return;
+		std::memcpy(decompress(last), &free_lists[units], sizeof(uint32_t));
+		free_lists[units] = first;
+	}
+
+	uint32_t offset_arena::compress(const void* ptr) const noexcept
+	{
+		return ptr ? static_cast<uint32_t>((static_cast<const unsigned char*>(ptr) - base) / unit_) : 0;
+	}
+
+	void* offset_arena::decompress(uint32_t offset) const noexcept
+	{
+		return offset ? base + size_t(offset) * unit_ : nullptr;
+	}
+
+	void offset_arena::reset() noexcept
+	{
+		used_ = unit_;
+		std::memset(free_lists, 0, sizeof(free_lists));
+	}
+
+	size_t offset_arena::unit() const noexcept
+	{
+		return unit_;
+	}
+
+	size_t offset_arena::used() const noexcept
+	{
+		return used_;
+	}
+
+	size_t offset_arena::capacity() const noexcept
+	{
+		return capacity_;
+	}
+
+	template<typename Elem> template<typename... Args>
+	compressed_forward_list<Elem>::Node::Node(Args&&... args) : data(std::forward<Args>(args)...) { }
+
+	template<typename Elem>
+	typename compressed_forward_list<Elem>::Link* compressed_forward_list<Elem>::_link(uint32_t offset) const noexcept
+	{
+		return static_cast<Link*>(arena->decompress(offset));
+	}
+
+	template<typename Elem>
+	Elem& compressed_forward_list<Elem>::_data(uint32_t offset) const noexcept
+	{
+		return static_cast<Node*>(_link(offset))->data;
+	}
+
+	template<typename Elem> template<typename... Args>
+	uint32_t compressed_forward_list<Elem>::_create_node(Args&&... args)
+	{
+		auto ptr = arena->allocate(sizeof(Node));
+		try
+		{
+			::new (ptr) Node(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			arena->deallocate(ptr, sizeof(Node));
+			throw;
+		}
+		return arena->compress(ptr);
+	}
+
+	template<typename Elem>
+	void compressed_forward_list<Elem>::_destroy_node(uint32_t offset) noexcept
+	{
+		auto node = static_cast<Node*>(_link(offset));
+		node->~Node();
+		arena->deallocate(node, sizeof(Node));
+	}
+
+	template<typename Elem>
+	void compressed_forward_list<Elem>::_ensure_head()
+	{
+		if (!head) head = tail = arena->compress(::new (arena->allocate(sizeof(Link))) Link);
+	}
+
+	template<typename Elem>
+	compressed_forward_list<Elem>::const_iterator::const_iterator(const offset_arena* arena_, uint32_t node_) noexcept : arena(arena_), node(node_) { }
+
+	template<typename Elem>
+	const Elem& compressed_forward_list<Elem>::const_iterator::operator*() const
+	{
+#ifndef NDEBUG
+		if (!node) error_info("Dereference of end() of tvj::compressed_forward_list.", TVJ_FORWARD_LIST_NULLPTR);
+#endif
+		return static_cast<const Node*>(arena->decompress(node))->data;
+	}
+
+	template<typename Elem>
+	const Elem* compressed_forward_list<Elem>::const_iterator::operator->() const
+	{
+		return &**this;
+	}
+
+	template<typename Elem>
+	typename compressed_forward_list<Elem>::const_iterator& compressed_forward_list<Elem>::const_iterator::operator++()
+	{
+#ifndef NDEBUG
+		if (!node) error_info("Increment of end() of tvj::compressed_forward_list.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		node = static_cast<const Link*>(arena->decompress(node))->succ;
+		return *this;
+	}
+
+	template<typename Elem>
+	typename compressed_forward_list<Elem>::const_iterator compressed_forward_list<Elem>::const_iterator::operator++(int)
+	{
+		auto ret = *this;
+		++*this;
+		return ret;
+	}
+
+	template<typename Elem>
+	bool compressed_forward_list<Elem>::const_iterator::operator==(const const_iterator& iter) const noexcept
+	{
+		return node == iter.node;
+	}
+
+	template<typename Elem>
+	bool compressed_forward_list<Elem>::const_iterator::operator!=(const const_iterator& iter) const noexcept
+	{
+		return node != iter.node;
+	}
+
+	template<typename Elem>
+	Elem& compressed_forward_list<Elem>::iterator::operator*() const
+	{
+		return const_cast<Elem&>(const_iterator::operator*());
+	}
+
+	template<typename Elem>
+	Elem* compressed_forward_list<Elem>::iterator::operator->() const
+	{
+		return &**this;
+	}
+
+	template<typename Elem>
+	typename compressed_forward_list<Elem>::iterator& compressed_forward_list<Elem>::iterator::operator++()
+	{
+		const_iterator::operator++();
+		return *this;
+	}
+
+	template<typename Elem>
+	typename compressed_forward_list<Elem>::iterator compressed_forward_list<Elem>::iterator::operator++(int)
+	{
+		auto ret = *this;
+		++*this;
+		return ret;
+	}
+
+	template<typename Elem>
+	compressed_forward_list<Elem>::compressed_forward_list(offset_arena& arena_) : arena(&arena_)
+	{
+#ifndef NDEBUG
+		if (alignof(Node) > arena_.unit())
+			error_info("The node alignment is larger than the unit of tvj::offset_arena.", TVJ_FORWARD_LIST_TYPE_MISMATCH);
+#endif
+	}
+
+	template<typename Elem>
+	compressed_forward_list<Elem>::compressed_forward_list(const compressed_forward_list& list_) : compressed_forward_list(*list_.arena)
+	{
+		for (const auto& elem : list_) push_back(elem);
+	}
+
+	template<typename Elem>
+	compressed_forward_list<Elem>::compressed_forward_list(compressed_forward_list&& list_) noexcept
+		: arena(list_.arena), head(list_.head), tail(list_.tail), size_(list_.size_)
+	{
+		// list_ allocates a new sentinel on its next insertion
+		list_.head = list_.tail = 0;
+		list_.size_ = 0;
+	}
+
+	template<typename Elem>
+	compressed_forward_list<Elem>::~compressed_forward_list()
+	{
+		clear();
+		if (head) arena->deallocate(_link(head), sizeof(Link));
+	}
+
+	template<typename Elem>
+	compressed_forward_list<Elem>& compressed_forward_list<Elem>::operator=(const compressed_forward_list& list_)
+	{
+		if (&list_ == this) return *this;
+		clear();
+		for (const auto& elem : list_) push_back(elem);
+		return *this;
+	}
+
+	template<typename Elem>
+	constexpr size_t compressed_forward_list<Elem>::node_size() noexcept
+	{
+		return sizeof(Node);
+	}
+
+	template<typename Elem>
+	void compressed_forward_list<Elem>::clear() noexcept
+	{
+		if (!head) return;
+		auto first = _link(head)->succ;
+		if (std::is_trivially_destructible<Elem>::value)
+		{
+			// the nodes are already chained by the offsets at their start
+			if (first) arena->deallocate_chain(first, tail, sizeof(Node));
+		}
+		else while (first)
+		{
+			auto next = _link(first)->succ;
+			_destroy_node(first);
+			first = next;
+		}
+		_link(head)->succ = 0;
+		tail = head;
+		size_ = 0;
+	}
+
+	template<typename Elem>
+	size_t compressed_forward_list<Elem>::size() const noexcept
+	{
+		return size_;
+	}
+
+	template<typename Elem>
+	bool compressed_forward_list<Elem>::empty() const noexcept
+	{
+		return !size_;
+	}
+
+	template<typename Elem>
+	typename compressed_forward_list<Elem>::iterator compressed_forward_list<Elem>::before_begin()
+	{
+		_ensure_head();
+		return iterator(arena, head);
+	}
+
+	template<typename Elem>
+	typename compressed_forward_list<Elem>::iterator compressed_forward_list<Elem>::begin() noexcept
+	{
+		return iterator(arena, head ? _link(head)->succ : 0);
+	}
+
+	template<typename Elem>
+	typename compressed_forward_list<Elem>::iterator compressed_forward_list<Elem>::back() noexcept
+	{
+		return iterator(arena, tail == head ? 0 : tail);
+	}
+
+	template<typename Elem>
+	typename compressed_forward_list<Elem>::iterator compressed_forward_list<Elem>::end() noexcept
+	{
+		return iterator(arena, 0);
+	}
+
+	template<typename Elem>
+	typename compressed_forward_list<Elem>::const_iterator compressed_forward_list<Elem>::before_begin() const noexcept
+	{
+		return const_iterator(arena, head);
+	}
+
+	template<typename Elem>
+	typename compressed_forward_list<Elem>::const_iterator compressed_forward_list<Elem>::begin() const noexcept
+	{
+		return const_iterator(arena, head ? _link(head)->succ : 0);
+	}
+
+	template<typename Elem>
+	typename compressed_forward_list<Elem>::const_iterator compressed_forward_list<Elem>::back() const noexcept
+	{
+		return const_iterator(arena, tail == head ? 0 : tail);
+	}
+
+	template<typename Elem>
+	typename compressed_forward_list<Elem>::const_iterator compressed_forward_list<Elem>::end() const noexcept
+	{
+		return const_iterator(arena, 0);
+	}
+
+	template<typename Elem>
+	typename compressed_forward_list<Elem>::const_iterator compressed_forward_list<Elem>::find(const Elem& elem) const noexcept
+	{
+		auto node = begin().node;
+		while (node && !(_data(node) == elem)) node = _link(node)->succ;
+		return const_iterator(arena, node);
+	}
+
+	template<typename Elem>
+	void compressed_forward_list<Elem>::push_front(const Elem& elem)
+	{
+		insert_after(before_begin(), elem);
+	}
+
+	template<typename Elem>
+	void compressed_forward_list<Elem>::push_back(const Elem& elem)
+	{
+		_ensure_head();
+		insert_after(const_iterator(arena, tail), elem);
+	}
+
+	template<typename Elem>
+	void compressed_forward_list<Elem>::pop_front()
+	{
+#ifndef NDEBUG
+		if (empty()) error_info("Pop from an empty tvj::compressed_forward_list.", TVJ_FORWARD_LIST_UNDERFLOW);
+#endif
+		erase_after(before_begin());
+	}
+
+	template<typename Elem>
+	typename compressed_forward_list<Elem>::iterator compressed_forward_list<Elem>::insert_after(const const_iterator& iter, const Elem& elem)
+	{
+#ifndef NDEBUG
+		if (!iter.node) error_info("Insert after end() of tvj::compressed_forward_list.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		const auto node = _create_node(elem);
+		auto pos = _link(iter.node);
+		_link(node)->succ = pos->succ;
+		pos->succ = node;
+		if (iter.node == tail) tail = node;
+		size_++;
+		return iterator(arena, node);
+	}
+
+	template<typename Elem>
+	typename compressed_forward_list<Elem>::iterator compressed_forward_list<Elem>::erase_after(const const_iterator& iter)
+	{
+#ifndef NDEBUG
+		if (!iter.node || iter.node == tail) error_info("Erase after the last element of tvj::compressed_forward_list.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		auto pos = _link(iter.node);
+		const auto node = pos->succ;
+		pos->succ = _link(node)->succ;
+		if (node == tail) tail = iter.node;
+		_destroy_node(node);
+		size_--;
+		return iterator(arena, pos->succ);
+	}
+
+	template<typename Elem> template<typename Predicate>
+	size_t compressed_forward_list<Elem>::remove_if(Predicate pred)
+	{
+		if (!head) return 0;
+		size_t removed = 0;
+		auto prev = head;
+		while (const auto node = _link(prev)->succ)
+		{
+			if (pred(_data(node)))
+			{
+				// keep tail and size_ valid in case pred throws later
+				_link(prev)->succ = _link(node)->succ;
+				if (node == tail) tail = prev;
+				_destroy_node(node);
+				size_--;
+				removed++;
+			}
+			else prev = node;
+		}
+		return removed;
+	}
+
+	template<typename Elem>
+	void compressed_forward_list<Elem>::reverse() noexcept
+	{
+		if (!head) return;
+		uint32_t reversed = 0;
+		auto node = _link(head)->succ;
+		tail = node ? node : head;
+		while (node)
+		{
+			auto link = _link(node);
+			const auto next = link->succ;
+			link->succ = reversed;
+			reversed = node;
+			node = next;
+		}
+		_link(head)->succ = reversed;
+	}
+};
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
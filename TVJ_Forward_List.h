@@ -6,6 +6,16 @@
  * @licence: The MIT Licence
  * @compiler: at least C++/11 (tested on MSVC and MinGW)
  *
+ * @version 1.2 2026/10/18
+ * - add fused in-place transform / filter pipeline
+ * - add partition, stable_partition and partition_into
+ * - add partial_sort and nth_element
+ * - add sort_by_key and merge_by_key with cached keys
+ * - add radix_sort for strings
+ * - add the allocator parameter and tvj::pmr::forward_list
+ * - add debug check for lists whose allocator memory was released
+ * - add splice_after
+ *
  * @version 1.1 2021/03/20
  * - modidy functions
  * - add DEBUG check
@@ -18,12 +28,25 @@
 #pragma once
 
 #include <stdexcept>
+#include <algorithm>
 #include <exception>
 #include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include <deque>
 #include <list>
 
+// std::pmr is available since C++17
+#if defined(__has_include)
+#if __has_include(<memory_resource>) && ((defined(_MSVC_LANG) && _MSVC_LANG >= 201703L) || __cplusplus >= 201703L)
+#include <memory_resource>
+#define TVJ_FORWARD_LIST_PMR
+#endif
+#endif
+
 namespace tvj
 {
 
@@ -37,7 +60,8 @@ namespace tvj
 		TVJ_FORWARD_LIST_OVERFLOW,
 		TVJ_FORWARD_LIST_TYPE_MISMATCH,
 		TVJ_FORWARD_LIST_NULLPTR,
-		TVJ_FORWARD_LIST_ITER_RANGE
+		TVJ_FORWARD_LIST_ITER_RANGE,
+		TVJ_FORWARD_LIST_DANGLING
 	};
 
 	/**
@@ -68,6 +92,9 @@ namespace tvj
 		case TVJ_FORWARD_LIST_ITER_RANGE:
 			throw std::range_error(text);
 			break;
+		case TVJ_FORWARD_LIST_DANGLING:
+			throw std::runtime_error(text);
+			break;
 		default:
 #ifdef _MSC_VER // MSVC compiler
 			throw std::exception(text);
@@ -78,9 +105,82 @@ namespace tvj
 		}
 	}
 
+	// Allocators whose memory is released in bulk (like tvj::arena_allocator) specialize it as std::true_type,
+	// then lists of trivially destructible elements skip releasing the nodes one by one.
+	template<typename Alloc>
+	struct is_bulk_release_allocator : std::false_type { };
+
+	// The stable merge sort on nullptr-terminated chains used by the lists that sort by relinking,
+	// Link has the successor pointer succ and Node (Link itself or derived from it) has data.
+	template<typename Link, typename Node = Link>
+	struct chain_sort
+	{
+		// the strict order of ASCENDING or DESCENDING
+		struct order
+		{
+			bool is_ascending;
+			template<typename T>
+			inline bool operator()(const T& a, const T& b) const;
+		};
+
+		// merge two sorted chains (the first one wins ties), return the first node
+		template<typename Compare>
+		static Link* merge(Link* first_1, Link* first_2, const Compare& comp);
+
+		// sort the first n nodes from rest into a chain, rest is moved to the node after them
+		template<typename Compare>
+		static Link* sort(Link*& rest, size_t n, const Compare& comp);
+	};
+
+	template<typename Link, typename Node> template<typename T>
+	bool chain_sort<Link, Node>::order::operator()(const T& a, const T& b) const
+	{
+		return is_ascending ? a < b : b < a;
+	}
+
+	template<typename Link, typename Node> template<typename Compare>
+	Link* chain_sort<Link, Node>::merge(Link* first_1, Link* first_2, const Compare& comp)
+	{
+		Link* first = nullptr;
+		Link** link = &first;
+		while (first_1 && first_2)
+		{
+			if (comp(static_cast<Node*>(first_2)->data, static_cast<Node*>(first_1)->data))
+			{
+				*link = first_2;
+				first_2 = first_2->succ;
+			}
+			else
+			{
+				*link = first_1;
+				first_1 = first_1->succ;
+			}
+			link = &(*link)->succ;
+		}
+		*link = first_1 ? first_1 : first_2;
+		return first;
+	}
+
+	template<typename Link, typename Node> template<typename Compare>
+	Link* chain_sort<Link, Node>::sort(Link*& rest, size_t n, const Compare& comp)
+	{
+		if (n == 0) return nullptr;
+		if (n == 1)
+		{
+			auto first = rest;
+			rest = rest->succ;
+			first->succ = nullptr;
+			return first;
+		}
+		auto first_1 = sort(rest, n / 2, comp);
+		auto first_2 = sort(rest, n - n / 2, comp);
+		return merge(first_1, first_2, comp);
+	}
+
 	// The tvj::forward_list class
-	// that supports functions similar to the STL class.
-	template<typename Elem>
+	// that supports functions similar to the STL class,
+	// the nodes are allocated by Alloc (rebound to the node type).
+	template<typename Elem, typename Alloc = std::allocator<Elem>>
 	class forward_list
 	{
 	protected:
@@ -94,9 +194,37 @@ namespace tvj
 			Node* succ = nullptr; // the pointer that points to the successor of the forward list
 		};
 
+	public:
+		typedef Alloc allocator_type;
+
+	protected:
+		typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node> node_allocator;
+		typedef std::allocator_traits<node_allocator> node_traits;
+
+		// allocate and construct a node with the allocator
+		template<typename... Args>
+		Node* _create_node(Args&&... args);
+
+		// destroy and deallocate a node with the allocator
+		void _destroy_node(Node* node) noexcept;
+
+		// exchange the nodes of two lists
+		void _swap_nodes(forward_list& list_) noexcept;
+
+		// exchange the allocators of two lists if they are propagated
+		void _swap_alloc(forward_list& list_, std::true_type) noexcept;
+		void _swap_alloc(forward_list& list_, std::false_type) noexcept;
+
+		// allocators with valid() (like tvj::arena_allocator) tell whether their memory is still alive
+		template<typename A>
+		static auto _alloc_valid(const A& alloc, int) noexcept -> decltype(static_cast<bool>(alloc.valid()));
+		template<typename A>
+		static bool _alloc_valid(const A& alloc, long) noexcept;
+
 	private:
-		Node*  head = new Node;
-		Node*  tail = head->succ = new Node;
+		node_allocator alloc_; // declared before head and tail which are allocated by it
+		Node*  head = _create_node();
+		Node*  tail = head->succ = _create_node();
 		size_t size_ = 0;
 
 		auto head_share()
@@ -107,14 +235,14 @@ namespace tvj
 	public:
 		class const_iterator
 		{
-			friend class forward_list<Elem>;
+			friend class forward_list<Elem, Alloc>;
 
 		protected:
 			Node* node;
-			const forward_list<Elem>* parent;
+			const forward_list<Elem, Alloc>* parent;
 
 		public:
-			const_iterator(Node* node_, const forward_list<Elem>* parent_);
+			const_iterator(Node* node_, const forward_list<Elem, Alloc>* parent_);
 		public:
 			inline const Elem& operator*() const;
 			inline const Elem* operator->() const;
@@ -144,23 +272,52 @@ namespace tvj
 		forward_list();
 
 		/**
-		 * brief: constructor for empty constuctor list
-		 * param: (void)
+		 * brief: constructor for empty list using the allocator
+		 * param: the allocator
+		 * return: --
+		 */
+		explicit forward_list(const Alloc& alloc);
+
+		/**
+		 * brief: copy constructor (the allocator is selected by select_on_container_copy_construction)
+		 * param: another list
+		 * return: --
+		 */
+		explicit forward_list(const forward_list<Elem, Alloc>& list_);
+
+		/**
+		 * brief: copy constructor using the allocator
+		 * param: another list, the allocator
+		 * return: --
+		 */
+		forward_list(const forward_list<Elem, Alloc>& list_, const Alloc& alloc);
+
+		/**
+		 * brief: move constructor (the allocator is moved with the nodes)
+		 * param: another list
 		 * return: --
 		 */
-		explicit forward_list(const forward_list<Elem>& list_);
+		forward_list(forward_list<Elem, Alloc>&& list_);
+
+		/**
+		 * brief: move constructor using the allocator,
+		 *        the elements are copied if the allocators are not equal
+		 * param: another list, the allocator
+		 * return: --
+		 */
+		forward_list(forward_list<Elem, Alloc>&& list_, const Alloc& alloc);
 
 		/**
 		 * brief: constructor for a container
-		 * param: a container that supports iterators
+		 * param: a container that supports iterators, the allocator
 		 * return: --
 		 */
-		template<typename Container_Type>
-		forward_list(const Container_Type& container);
+		template<typename Container_Type, typename = typename std::enable_if<!std::is_constructible<Alloc, Container_Type&>::value>::type>
+		forward_list(const Container_Type& container, const Alloc& alloc = Alloc());
 
 		/**
 		 * brief: constructor for iterators where the range of iterators are not checked during DEBUG
-		 * param: two iterators
+		 * param: two iterators, the allocator
 		 * return: --
 		 */
 		template<typename _Iter>
@@ -172,11 +329,11 @@ namespace tvj
 			! std::is_same<std::decay<_Iter>, std::decay<typename std::deque <Elem>::iterator      >>::value &&
 			! std::is_same<std::decay<_Iter>, std::decay<typename std::list  <Elem>::const_iterator>>::value &&
 			! std::is_same<std::decay<_Iter>, std::decay<typename std::list  <Elem>::iterator      >>::value,
-			const _Iter&>::type i_end);
+			const _Iter&>::type i_end, const Alloc& alloc = Alloc());
 
 		/**
 		 * brief: constructor for iterators where the range of iterators are checked during DEBUG
-		 * param: two iterators
+		 * param: two iterators, the allocator
 		 * return: --
 		 */
 		template<typename _Iter>
@@ -188,14 +345,14 @@ namespace tvj
 			std::is_same<std::decay<_Iter>, std::decay<typename std::deque <Elem>::iterator      >>::value ||
 			std::is_same<std::decay<_Iter>, std::decay<typename std::list  <Elem>::const_iterator>>::value ||
 			std::is_same<std::decay<_Iter>, std::decay<typename std::list  <Elem>::iterator      >>::value,
-			const _Iter&>::type i_end);
+			const _Iter&>::type i_end, const Alloc& alloc = Alloc());
 
 		/**
 		 * brief: constructor two pointers
-		 * param: two pointers
+		 * param: two pointers, the allocator
 		 * return: --
 		 */
-		forward_list(const Elem* i_beg, const Elem* i_end);
+		forward_list(const Elem* i_beg, const Elem* i_end, const Alloc& alloc = Alloc());
 
 		/**
 		 * @brief: destructor
@@ -204,6 +361,35 @@ namespace tvj
 		 */
 		~forward_list();
 
+		/**
+		 * brief: copy assignment (the allocator is propagated if propagate_on_container_copy_assignment)
+		 * param: another list
+		 * return: forward_list&
+		 */
+		forward_list& operator=(const forward_list<Elem, Alloc>& list_);
+
+		/**
+		 * brief: move assignment (the allocator is propagated if propagate_on_container_move_assignment),
+		 *        the elements are copied if the allocators are not equal and not propagated
+		 * param: another list
+		 * return: forward_list&
+		 */
+		forward_list& operator=(forward_list<Elem, Alloc>&& list_);
+
+		/**
+		 * brief: exchange the elements with another list (the allocators must be equal unless propagate_on_container_swap)
+		 * param: another list
+		 * return: void
+		 */
+		void swap(forward_list<Elem, Alloc>& list_);
+
+		/**
+		 * brief: the allocator of the list
+		 * param: (void)
+		 * return: allocator_type
+		 */
+		inline allocator_type get_allocator() const;
+
 		/**
 		 * brief: clear all elements in the list
 		 * param: (void)
@@ -444,7 +630,34 @@ namespace tvj
 		 */
 		void merge(const forward_list& list_, bool is_ascending = ASCENDING);
 
+		/**
+		 * brief: move all elements of another list after the iterator without copying (list_ becomes empty),
+		 *        the allocators must be equal
+		 * param: the iterator, another list with the same element type
+		 * return: void
+		 */
+		void splice_after(const const_iterator& iter, forward_list& list_);
+
+		/**
+		 * brief: move the element after iter_ of another list after the iterator without copying,
+		 *        the allocators must be equal
+		 * param: the iterator, another list with the same element type, the iterator before the element in list_
+		 * return: void
+		 */
+		void splice_after(const const_iterator& iter, forward_list& list_, const const_iterator& iter_);
+
+		/**
+		 * brief: move the elements in (first, last) of another list after the iterator without copying,
+		 *        the allocators must be equal
+		 * param: the iterator, another list with the same element type, two iterators of list_
+		 * return: void
+		 */
+		void splice_after(const const_iterator& iter, forward_list& list_, const const_iterator& first, const const_iterator& last);
+
 	protected:
+		// move the nodes in (first, last) of list_ after node pos, return the number of moved nodes
+		size_t _splice_after(Node* pos, const forward_list& list_, Node* first, Node* last);
+
 		// merge the two parts in order
 		// Range 1: (first_, mid_]
 		// Range 2: (mid_, last_]
@@ -464,24 +677,195 @@ namespace tvj
 		 */
 		void sort(bool is_ascending = ASCENDING);
 
+	protected:
+		// the stage that keeps every element (start of a pipeline)
+		struct _keep_stage
+		{
+			inline bool operator()(Elem& elem) const noexcept;
+		};
+
+		// apply the previous stage and then transform the element
+		template<typename Stage, typename Transform>
+		struct _transform_stage
+		{
+			Stage     stage;
+			Transform fn;
+			inline bool operator()(Elem& elem);
+		};
+
+		// apply the previous stage and then check the element
+		template<typename Stage, typename Predicate>
+		struct _filter_stage
+		{
+			Stage     stage;
+			Predicate pred;
+			inline bool operator()(Elem& elem);
+		};
+
+		// visit each node once, apply the stage and unlink the nodes it rejects
+		template<typename Stage>
+		size_t _apply_inplace(Stage& stage);
+
+	public:
+		// The in-place pipeline built by inplace_pipeline(),
+		// all the stages are fused and run in one traversal.
+		template<typename Stage>
+		class pipeline
+		{
+			friend class forward_list<Elem, Alloc>;
+			template<typename> friend class pipeline;
+
+		protected:
+			forward_list<Elem, Alloc>* list;
+			Stage stage;
+
+			pipeline(forward_list<Elem, Alloc>* list_, const Stage& stage_);
+
+		public:
+			/**
+			 * brief: add a stage that modifies the element (called with Elem&)
+			 * param: the transform function
+			 * return: pipeline
+			 */
+			template<typename Transform>
+			inline pipeline<_transform_stage<Stage, Transform>> transform(Transform fn) const;
+
+			/**
+			 * brief: add a stage that unlinks the element if the predicate is false
+			 * param: the predicate
+			 * return: pipeline
+			 */
+			template<typename Predicate>
+			inline pipeline<_filter_stage<Stage, Predicate>> filter(Predicate pred) const;
+
+			/**
+			 * brief: run all the stages in one traversal of the list
+			 * param: (void)
+			 * return: size_t (number of removed elements)
+			 */
+			inline size_t run();
+		};
+
+		/**
+		 * brief: transform each element and unlink the ones that fail the predicate in one traversal
+		 * param: the transform function (called with Elem&), the predicate (the element is kept if true)
+		 * return: size_t (number of removed elements)
+		 */
+		template<typename Transform, typename Predicate>
+		size_t transform_filter_inplace(Transform fn, Predicate pred);
+
+		/**
+		 * brief: start an in-place pipeline, e.g. inplace_pipeline().transform(f).filter(p).run()
+		 * param: (void)
+		 * return: pipeline
+		 */
+		inline pipeline<_keep_stage> inplace_pipeline() noexcept;
+
+		/**
+		 * brief: partition the list by relinking the matching nodes behind the boundary (no Elem is moved or copied)
+		 * param: the predicate (true for the first part)
+		 * return: iterator (the first element of the second part, or end())
+		 */
+		template<typename Predicate>
+		iterator partition(Predicate pred);
+
+		/**
+		 * brief: partition the list keeping the relative order of both parts,
+		 *        it builds two chains in one pass and concatenates them
+		 * param: the predicate (true for the first part)
+		 * return: iterator (the first element of the second part, or end())
+		 */
+		template<typename Predicate>
+		iterator stable_partition(Predicate pred);
+
+		/**
+		 * brief: move the elements failing the predicate to the end of another list,
+		 *        without allocation if the allocators are equal (otherwise the elements are copied)
+		 * param: the predicate (true to stay in *this), another list with the same element type
+		 * return: size_t (number of moved elements)
+		 */
+		template<typename Predicate>
+		size_t partition_into(Predicate pred, forward_list& list_);
+
+	protected:
+		// the sorted ranges are cut from the sentinels into nullptr-terminated chains
+		typedef chain_sort<Node> _chain;
+
+		// the strict order used by the sorting functions
+		typedef typename _chain::order _order;
+
+	public:
+		/**
+		 * brief: reorder the list so that the first k elements are the sorted smallest (largest) ones (stable,
+		 *        equal elements at the boundary are taken in list order), the others keep their relative order after them, O(n log k)
+		 * param: the number k, the sorting order (default as ASCENDING, otherwise DESCENDING)
+		 * return: void
+		 */
+		void partial_sort(size_t k, bool is_ascending = ASCENDING);
+
+		/**
+		 * brief: quickselect by relinking, the n-th element (from 0) is the one it would be after sort()
+		 *        with no greater (less) element before it and no less (greater) element after it, expected O(n)
+		 * param: the index n, the sorting order (default as ASCENDING, otherwise DESCENDING)
+		 * return: iterator (the n-th element, or end() if n >= size())
+		 */
+		iterator nth_element(size_t n, bool is_ascending = ASCENDING);
+
+		/**
+		 * brief: stable sort by a derived key which is computed only once for each element
+		 * param: the key projection (called with const Elem&), the sorting order (default as ASCENDING, otherwise DESCENDING)
+		 * return: void
+		 */
+		template<typename Projection>
+		void sort_by_key(Projection proj, bool is_ascending = ASCENDING);
+
+		/**
+		 * brief: merge another list sorted by the same key by relinking (list_ becomes empty),
+		 *        the key is computed only once for each element (the elements are copied if the allocators are unequal)
+		 * param: another list with the same element type, the key projection, the sorting order (default as ASCENDING, otherwise DESCENDING)
+		 * return: void
+		 */
+		template<typename Projection>
+		void merge_by_key(forward_list& list_, Projection proj, bool is_ascending = ASCENDING);
+
+	protected:
+		// compare two strings from a certain position (all strings in a radix bucket share the prefix)
+		struct _suffix_order
+		{
+			size_t depth;
+			bool is_ascending;
+			inline bool operator()(const Elem& a, const Elem& b) const;
+		};
+
+	public:
+		/**
+		 * brief: MSD radix sort for std::string elements by relinking,
+		 *        small buckets fall back to the merge sort from the current depth
+		 * param: the sorting order (default as ASCENDING, otherwise DESCENDING)
+		 * return: void
+		 */
+		void radix_sort(bool is_ascending = ASCENDING);
+
 	};
 
-	template<typename Elem>
-	forward_list<Elem>::Node::Node() { }
+	template<typename Elem, typename Alloc>
+	forward_list<Elem, Alloc>::Node::Node() { }
 
-	template<typename Elem>
-	forward_list<Elem>::Node::Node(Elem data_, Node* succ_ptr) : data(data_), succ(succ_ptr) { }
+	template<typename Elem, typename Alloc>
+	forward_list<Elem, Alloc>::Node::Node(Elem data_, Node* succ_ptr) : data(data_), succ(succ_ptr) { }
 
-	template<typename Elem>
-	forward_list<Elem>::Node::~Node() { }
+	template<typename Elem, typename Alloc>
+	forward_list<Elem, Alloc>::Node::~Node() { }
 
-	template<typename Elem>
-	forward_list<Elem>::const_iterator::const_iterator(Node* node_, const forward_list<Elem>* parent_) : node(node_), parent(parent_) { }
+	template<typename Elem, typename Alloc>
+	forward_list<Elem, Alloc>::const_iterator::const_iterator(Node* node_, const forward_list<Elem, Alloc>* parent_) : node(node_), parent(parent_) { }
 
-	template<typename Elem>
-	const Elem& forward_list<Elem>::const_iterator::operator*() const
+	template<typename Elem, typename Alloc>
+	const Elem& forward_list<Elem, Alloc>::const_iterator::operator*() const
 	{
 #ifndef NDEBUG
+		if (!_alloc_valid(parent->alloc_, 0))
+			error_info("Dangling list in operator * of const_iterator of tvj::forward_list (its allocator memory was released).", TVJ_FORWARD_LIST_DANGLING);
 		if (!node)                error_info("Null pointer in operator * of const_iterator of tvj::forward_list.", TVJ_FORWARD_LIST_NULLPTR);
 		if (node == parent->head) error_info("Underflow in operator * of const_iterator of tvj::forward_list.",    TVJ_FORWARD_LIST_UNDERFLOW);
 		if (node == parent->tail) error_info("Overflow in operator * of const_iterator of tvj::forward_list.",     TVJ_FORWARD_LIST_OVERFLOW);
@@ -489,10 +873,12 @@ namespace tvj
 		return node->data;
 	}
 
-	template<typename Elem>
-	const Elem* forward_list<Elem>::const_iterator::operator->() const
+	template<typename Elem, typename Alloc>
+	const Elem* forward_list<Elem, Alloc>::const_iterator::operator->() const
 	{
 #ifndef NDEBUG
+		if (!_alloc_valid(parent->alloc_, 0))
+			error_info("Dangling list in operator -> of const_iterator of tvj::forward_list (its allocator memory was released).", TVJ_FORWARD_LIST_DANGLING);
 		if (!node)                error_info("Null pointer in operator -> of const_iterator of tvj::forward_list.", TVJ_FORWARD_LIST_NULLPTR);
 		if (node == parent->head) error_info("Underflow in operator -> of const_iterator of tvj::forward_list.", TVJ_FORWARD_LIST_UNDERFLOW);
 		if (node == parent->tail) error_info("Overflow in operator -> of const_iterator of tvj::forward_list.", TVJ_FORWARD_LIST_OVERFLOW);
@@ -500,10 +886,12 @@ namespace tvj
 		return &node->data;
 	}
 
-	template<typename Elem>
-	auto forward_list<Elem>::const_iterator::operator++()
+	template<typename Elem, typename Alloc>
+	auto forward_list<Elem, Alloc>::const_iterator::operator++()
 	{
 #ifndef NDEBUG
+		if (!_alloc_valid(parent->alloc_, 0))
+			error_info("Dangling list in operator ++ of const_iterator of tvj::forward_list (its allocator memory was released).", TVJ_FORWARD_LIST_DANGLING);
 		if (!node)                error_info("Null pointer in operator ++ of const_iterator of tvj::forward_list.", TVJ_FORWARD_LIST_NULLPTR);
 //		if (node == parent->head) error_info("Underflow in operator ++ of const_iterator of tvj::forward_list.", TVJ_FORWARD_LIST_UNDERFLOW);
 		if (node == parent->tail) error_info("Overflow in operator ++ of const_iterator of tvj::forward_list.", TVJ_FORWARD_LIST_OVERFLOW);
@@ -512,10 +900,12 @@ namespace tvj
 		return *this;
 	}
 
-	template<typename Elem>
-	auto forward_list<Elem>::const_iterator::operator++(int)
+	template<typename Elem, typename Alloc>
+	auto forward_list<Elem, Alloc>::const_iterator::operator++(int)
 	{
 #ifndef NDEBUG
+		if (!_alloc_valid(parent->alloc_, 0))
+			error_info("Dangling list in operator ++ of const_iterator of tvj::forward_list (its allocator memory was released).", TVJ_FORWARD_LIST_DANGLING);
 		if (!node)                error_info("Null pointer in operator ++ of const_iterator of tvj::forward_list.", TVJ_FORWARD_LIST_NULLPTR);
 //		if (node == parent->head) error_info("Underflow in operator ++ of const_iterator of tvj::forward_list.", TVJ_FORWARD_LIST_UNDERFLOW);
 		if (node == parent->tail) error_info("Overflow in operator ++ of const_iterator of tvj::forward_list.", TVJ_FORWARD_LIST_OVERFLOW);
@@ -525,8 +915,8 @@ namespace tvj
 		return ret;
 	}
 
-	template<typename Elem>
-	typename forward_list<Elem>::const_iterator forward_list<Elem>::const_iterator::operator+(const unsigned n) const
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::const_iterator forward_list<Elem, Alloc>::const_iterator::operator+(const unsigned n) const
 	{
 #ifndef NDEBUG
 		if (!node)                error_info("Null pointer in operator + of const_iterator of tvj::forward_list.", TVJ_FORWARD_LIST_NULLPTR);
@@ -546,8 +936,8 @@ namespace tvj
 		return const_iterator(_node, parent);
 	}
 
-	template<typename Elem>
-	typename forward_list<Elem>::const_iterator forward_list<Elem>::const_iterator::operator+=(const unsigned n)
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::const_iterator forward_list<Elem, Alloc>::const_iterator::operator+=(const unsigned n)
 	{
 #ifndef NDEBUG
 		if (!node)                error_info("Null pointer in operator += of const_iterator of tvj::forward_list.", TVJ_FORWARD_LIST_NULLPTR);
@@ -566,8 +956,8 @@ namespace tvj
 		return *this;
 	}
 
-	template<typename Elem>
-	bool forward_list<Elem>::const_iterator::operator==(const const_iterator& iter) const noexcept
+	template<typename Elem, typename Alloc>
+	bool forward_list<Elem, Alloc>::const_iterator::operator==(const const_iterator& iter) const noexcept
 	{
 #ifndef NDEBUG
 //		if (!node)                error_info("Null pointer in operator == of const_iterator of tvj::forward_list.", TVJ_FORWARD_LIST_NULLPTR);
@@ -577,8 +967,8 @@ namespace tvj
 		return this->node == iter.node;
 	}
 
-	template<typename Elem>
-	bool forward_list<Elem>::const_iterator::operator!=(const const_iterator& iter) const noexcept
+	template<typename Elem, typename Alloc>
+	bool forward_list<Elem, Alloc>::const_iterator::operator!=(const const_iterator& iter) const noexcept
 	{
 #ifndef NDEBUG
 //		if (!node)                error_info("Null pointer in operator != of const_iterator of tvj::forward_list.", TVJ_FORWARD_LIST_NULLPTR);
@@ -588,11 +978,13 @@ namespace tvj
 		return this->node != iter.node;
 	}
 
-	template<typename Elem>
-	Elem& forward_list<Elem>::iterator::operator*()
+	template<typename Elem, typename Alloc>
+	Elem& forward_list<Elem, Alloc>::iterator::operator*()
 	{
 #ifndef NDEBUG
-		if (!const_iterator::node)                                
+		if (!_alloc_valid(const_iterator::parent->alloc_, 0))
+			error_info("Dangling list in operator * of iterator of tvj::forward_list (its allocator memory was released).", TVJ_FORWARD_LIST_DANGLING);
+		if (!const_iterator::node)
 			error_info("Null pointer in operator * of iterator of tvj::forward_list.", TVJ_FORWARD_LIST_NULLPTR);
 		if (const_iterator::node == const_iterator::parent->head)
 		    error_info("Underflow in operator * of iterator of tvj::forward_list.", TVJ_FORWARD_LIST_UNDERFLOW);
@@ -602,10 +994,12 @@ namespace tvj
 		return const_iterator::node->data;
 	}
 
-	template<typename Elem>
-	Elem* forward_list<Elem>::iterator::operator->()
+	template<typename Elem, typename Alloc>
+	Elem* forward_list<Elem, Alloc>::iterator::operator->()
 	{
 #ifndef NDEBUG
+		if (!_alloc_valid(const_iterator::parent->alloc_, 0))
+			error_info("Dangling list in operator -> of iterator of tvj::forward_list (its allocator memory was released).", TVJ_FORWARD_LIST_DANGLING);
 		if (!const_iterator::node)
 			error_info("Null pointer in operator -> of iterator of tvj::forward_list.", TVJ_FORWARD_LIST_NULLPTR);
 		if (const_iterator::node == const_iterator::parent->head)
@@ -616,11 +1010,24 @@ namespace tvj
 		return &const_iterator::node->data;
 	}
 
-	template<typename Elem>
-	forward_list<Elem>::forward_list() { }
+	template<typename Elem, typename Alloc>
+	forward_list<Elem, Alloc>::forward_list() { }
+
+	template<typename Elem, typename Alloc>
+	forward_list<Elem, Alloc>::forward_list(const Alloc& alloc) : alloc_(alloc) { }
+
+	template<typename Elem, typename Alloc>
+	forward_list<Elem, Alloc>::forward_list(const forward_list<Elem, Alloc>& list_)
+		: alloc_(node_traits::select_on_container_copy_construction(list_.alloc_))
+	{
+		for (const auto& elem : list_)
+		{
+			this->push_back(elem);
+		}
+	}
 
-	template<typename Elem>
-	forward_list<Elem>::forward_list(const forward_list<Elem>& list_)
+	template<typename Elem, typename Alloc>
+	forward_list<Elem, Alloc>::forward_list(const forward_list<Elem, Alloc>& list_, const Alloc& alloc) : alloc_(alloc)
 	{
 		for (const auto& elem : list_)
 		{
@@ -628,8 +1035,28 @@ namespace tvj
 		}
 	}
 
-	template<typename Elem> template<typename Container_Type>
-	forward_list<Elem>::forward_list(const Container_Type& container)
+	template<typename Elem, typename Alloc>
+	forward_list<Elem, Alloc>::forward_list(forward_list<Elem, Alloc>&& list_) : alloc_(std::move(list_.alloc_))
+	{
+		_swap_nodes(list_);
+	}
+
+	template<typename Elem, typename Alloc>
+	forward_list<Elem, Alloc>::forward_list(forward_list<Elem, Alloc>&& list_, const Alloc& alloc) : alloc_(alloc)
+	{
+		if (alloc_ == list_.alloc_)
+		{
+			_swap_nodes(list_);
+			return;
+		}
+		for (const auto& elem : list_)
+		{
+			this->push_back(elem);
+		}
+	}
+
+	template<typename Elem, typename Alloc> template<typename Container_Type, typename>
+	forward_list<Elem, Alloc>::forward_list(const Container_Type& container, const Alloc& alloc) : alloc_(alloc)
 	{
 		for (const auto& elem : container)
 		{
@@ -637,8 +1064,8 @@ namespace tvj
 		}
 	}
 
-	template<typename Elem> template<typename _Iter>
-	forward_list<Elem>::forward_list(const _Iter& i_beg,
+	template<typename Elem, typename Alloc> template<typename _Iter>
+	forward_list<Elem, Alloc>::forward_list(const _Iter& i_beg,
 		typename std::enable_if<
 		! std::is_same<std::decay<_Iter>, std::decay<typename std::vector<Elem>::const_iterator>>::value &&
 		! std::is_same<std::decay<_Iter>, std::decay<typename std::vector<Elem>::iterator      >>::value &&
@@ -646,7 +1073,7 @@ namespace tvj
 		! std::is_same<std::decay<_Iter>, std::decay<typename std::deque <Elem>::iterator      >>::value &&
 		! std::is_same<std::decay<_Iter>, std::decay<typename std::list  <Elem>::const_iterator>>::value &&
 		! std::is_same<std::decay<_Iter>, std::decay<typename std::list  <Elem>::iterator      >>::value,
-		const _Iter&>::type i_end)
+		const _Iter&>::type i_end, const Alloc& alloc) : alloc_(alloc)
 	{
 #ifndef NDEBUG
 		if (!std::is_class<_Iter>::value)
@@ -660,8 +1087,8 @@ namespace tvj
 		}
 	}
 
-	template<typename Elem> template<typename _Iter>
-	forward_list<Elem>::forward_list(const _Iter& i_beg,
+	template<typename Elem, typename Alloc> template<typename _Iter>
+	forward_list<Elem, Alloc>::forward_list(const _Iter& i_beg,
 		typename std::enable_if<
 		std::is_same<std::decay<_Iter>, std::decay<typename std::vector<Elem>::const_iterator>>::value ||
 	    std::is_same<std::decay<_Iter>, std::decay<typename std::vector<Elem>::iterator      >>::value ||
@@ -669,7 +1096,7 @@ namespace tvj
 	    std::is_same<std::decay<_Iter>, std::decay<typename std::deque <Elem>::iterator      >>::value ||
 		std::is_same<std::decay<_Iter>, std::decay<typename std::list  <Elem>::const_iterator>>::value ||
 		std::is_same<std::decay<_Iter>, std::decay<typename std::list  <Elem>::iterator      >>::value,
-		const _Iter&>::type i_end)
+		const _Iter&>::type i_end, const Alloc& alloc) : alloc_(alloc)
 	{
 #ifndef NDEBUG
 		if (!std::is_class<_Iter>::value)
@@ -687,8 +1114,8 @@ namespace tvj
 		}
 	}
 
-	template<typename Elem>
-	forward_list<Elem>::forward_list(const Elem* i_beg, const Elem* i_end)
+	template<typename Elem, typename Alloc>
+	forward_list<Elem, Alloc>::forward_list(const Elem* i_beg, const Elem* i_end, const Alloc& alloc) : alloc_(alloc)
 	{
 #ifndef NDEBUG
 		if (!i_beg) error_info("The constructor for tvj::forward_list has pointer i_beg to be a nullptr.", TVJ_FORWARD_LIST_NULLPTR);
@@ -700,116 +1127,218 @@ namespace tvj
 		}
 	}
 
-	template<typename Elem>
-	forward_list<Elem>::~forward_list()
+	template<typename Elem, typename Alloc>
+	forward_list<Elem, Alloc>::~forward_list()
 	{
+		// the nodes are already gone with the allocator memory
+		if (!_alloc_valid(alloc_, 0)) return;
+		if (is_bulk_release_allocator<Alloc>::value && std::is_trivially_destructible<Elem>::value) return;
+
 		erase_after(cbegin());
 #ifdef NDEBUG
-		if (head) delete head;
-		if (tail) delete tail;
+		if (head) _destroy_node(head);
+		if (tail) _destroy_node(tail);
 #endif
 	}
 
-	template<typename Elem>
-	void forward_list<Elem>::clear()
+	template<typename Elem, typename Alloc>
+	forward_list<Elem, Alloc>& forward_list<Elem, Alloc>::operator=(const forward_list<Elem, Alloc>& list_)
+	{
+		if (&list_ == this) return *this;
+		typedef typename node_traits::propagate_on_container_copy_assignment propagate;
+		forward_list<Elem, Alloc> new_list(list_, propagate::value ? list_.alloc_ : alloc_);
+		_swap_nodes(new_list);
+		_swap_alloc(new_list, propagate());
+		return *this;
+	}
+
+	template<typename Elem, typename Alloc>
+	forward_list<Elem, Alloc>& forward_list<Elem, Alloc>::operator=(forward_list<Elem, Alloc>&& list_)
+	{
+		if (&list_ == this) return *this;
+		typedef typename node_traits::propagate_on_container_move_assignment propagate;
+		if (propagate::value || alloc_ == list_.alloc_)
+		{
+			_swap_nodes(list_);
+			_swap_alloc(list_, propagate());
+			return *this;
+		}
+		forward_list<Elem, Alloc> new_list(list_, alloc_);
+		_swap_nodes(new_list);
+		return *this;
+	}
+
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::swap(forward_list<Elem, Alloc>& list_)
+	{
+		typedef typename node_traits::propagate_on_container_swap propagate;
+#ifndef NDEBUG
+		if (!propagate::value && !(alloc_ == list_.alloc_))
+			error_info("Swap of tvj::forward_list with unequal allocators.", TVJ_FORWARD_LIST_TYPE_MISMATCH);
+#endif
+		_swap_nodes(list_);
+		_swap_alloc(list_, propagate());
+	}
+
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::allocator_type forward_list<Elem, Alloc>::get_allocator() const
+	{
+		return allocator_type(alloc_);
+	}
+
+	template<typename Elem, typename Alloc> template<typename... Args>
+	typename forward_list<Elem, Alloc>::Node* forward_list<Elem, Alloc>::_create_node(Args&&... args)
+	{
+		auto node = node_traits::allocate(alloc_, 1);
+		try
+		{
+			node_traits::construct(alloc_, node, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			node_traits::deallocate(alloc_, node, 1);
+			throw;
+		}
+		return node;
+	}
+
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::_destroy_node(Node* node) noexcept
+	{
+		node_traits::destroy(alloc_, node);
+		node_traits::deallocate(alloc_, node, 1);
+	}
+
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::_swap_nodes(forward_list& list_) noexcept
+	{
+		std::swap(head,  list_.head);
+		std::swap(tail,  list_.tail);
+		std::swap(size_, list_.size_);
+	}
+
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::_swap_alloc(forward_list& list_, std::true_type) noexcept
+	{
+		using std::swap;
+		swap(alloc_, list_.alloc_);
+	}
+
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::_swap_alloc(forward_list&, std::false_type) noexcept { }
+
+	template<typename Elem, typename Alloc> template<typename A>
+	auto forward_list<Elem, Alloc>::_alloc_valid(const A& alloc, int) noexcept -> decltype(static_cast<bool>(alloc.valid()))
+	{
+		return alloc.valid();
+	}
+
+	template<typename Elem, typename Alloc> template<typename A>
+	bool forward_list<Elem, Alloc>::_alloc_valid(const A&, long) noexcept
+	{
+		return true;
+	}
+
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::clear()
 	{
 		erase_after(cbegin());
 	}
 
-	template<typename Elem>
-	const auto& forward_list<Elem>::size() const noexcept
+	template<typename Elem, typename Alloc>
+	const auto& forward_list<Elem, Alloc>::size() const noexcept
 	{
 		return size_;
 	}
 
-	template<typename Elem>
-	bool forward_list<Elem>::empty() const noexcept
+	template<typename Elem, typename Alloc>
+	bool forward_list<Elem, Alloc>::empty() const noexcept
 	{
 		return !size_;
 	}
 
-	template<typename Elem>
-	typename forward_list<Elem>::iterator forward_list<Elem>::before_begin() noexcept
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::iterator forward_list<Elem, Alloc>::before_begin() noexcept
 	{
 		return iterator(head, this);
 	}
 
-	template<typename Elem>
-	typename forward_list<Elem>::iterator forward_list<Elem>::begin() noexcept
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::iterator forward_list<Elem, Alloc>::begin() noexcept
 	{
 		return iterator(head->succ, this);
 	}
 
-	template<typename Elem>
-	typename forward_list<Elem>::iterator forward_list<Elem>::front() noexcept
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::iterator forward_list<Elem, Alloc>::front() noexcept
 	{
 		return iterator(head->succ, this);
 	}
 
-	template<typename Elem>
-	typename forward_list<Elem>::iterator forward_list<Elem>::back() noexcept
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::iterator forward_list<Elem, Alloc>::back() noexcept
 	{
 		auto i = before_begin();
 		while (i + 1 != end()) i++;
 		return i;
 	}
 
-	template<typename Elem>
-	typename forward_list<Elem>::iterator forward_list<Elem>::end() noexcept
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::iterator forward_list<Elem, Alloc>::end() noexcept
 	{
 		return iterator(tail, this);
 	}
 
-	template<typename Elem>
-	typename forward_list<Elem>::const_iterator forward_list<Elem>::before_begin() const noexcept
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::const_iterator forward_list<Elem, Alloc>::before_begin() const noexcept
 	{
 		return const_iterator(head, this);
 	}
 
-	template<typename Elem>
-	typename forward_list<Elem>::const_iterator forward_list<Elem>::begin() const noexcept
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::const_iterator forward_list<Elem, Alloc>::begin() const noexcept
 	{
 		return const_iterator(head->succ, this);
 	}
 
-	template<typename Elem>
-	typename forward_list<Elem>::const_iterator forward_list<Elem>::front() const noexcept
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::const_iterator forward_list<Elem, Alloc>::front() const noexcept
 	{
 		return iterator(head->succ, this);
 	}
 
-	template<typename Elem>
-	typename forward_list<Elem>::const_iterator forward_list<Elem>::back() const noexcept
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::const_iterator forward_list<Elem, Alloc>::back() const noexcept
 	{
 		return iterator(head->succ, this);
 	}
 
-	template<typename Elem>
-	typename forward_list<Elem>::const_iterator forward_list<Elem>::end() const noexcept
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::const_iterator forward_list<Elem, Alloc>::end() const noexcept
 	{
 		return const_iterator(tail, this);
 	}
 
-	template<typename Elem>
-	typename forward_list<Elem>::const_iterator forward_list<Elem>::cbefore_begin() const noexcept
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::const_iterator forward_list<Elem, Alloc>::cbefore_begin() const noexcept
 	{
 		return const_iterator(head, this);
 	}
 
-	template<typename Elem>
-	typename forward_list<Elem>::const_iterator forward_list<Elem>::cbegin() const noexcept
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::const_iterator forward_list<Elem, Alloc>::cbegin() const noexcept
 	{
 		return const_iterator(head->succ, this);
 	}
 
-	template<typename Elem>
-	typename forward_list<Elem>::const_iterator forward_list<Elem>::cend() const noexcept
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::const_iterator forward_list<Elem, Alloc>::cend() const noexcept
 	{
 		return const_iterator(tail, this);
 	}
 
-	template<typename Elem>
-	typename forward_list<Elem>::const_iterator forward_list<Elem>::find(const Elem& elem) const noexcept
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::const_iterator forward_list<Elem, Alloc>::find(const Elem& elem) const noexcept
 	{
 		for (auto iter = begin(); iter != end(); iter++)
 		{
@@ -818,8 +1347,8 @@ namespace tvj
 		return end();
 	}
 
-	template<typename Elem>
-	typename forward_list<Elem>::const_iterator forward_list<Elem>::search(const Elem& elem, bool is_ascending) const noexcept
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::const_iterator forward_list<Elem, Alloc>::search(const Elem& elem, bool is_ascending) const noexcept
 	{
 		auto iter = before_begin();
 		if (is_ascending ? *(iter + 1) < elem : *(iter + 1) > elem) return before_begin();
@@ -827,8 +1356,8 @@ namespace tvj
 		return iter;
 	}
 
-	template<typename Elem>
-	bool forward_list<Elem>::sorted(bool is_ascending) const noexcept
+	template<typename Elem, typename Alloc>
+	bool forward_list<Elem, Alloc>::sorted(bool is_ascending) const noexcept
 	{
 		if (size_ < 2) return true;
 		for (auto iter = cbegin(); iter + 1 != cend(); ++iter)
@@ -839,8 +1368,8 @@ namespace tvj
 		return true;
 	}
 
-	template<typename Elem>
-	bool forward_list<Elem>::contains(const Elem& elem) const noexcept
+	template<typename Elem, typename Alloc>
+	bool forward_list<Elem, Alloc>::contains(const Elem& elem) const noexcept
 	{
 		for (const auto elem_ : *this)
 		{
@@ -849,8 +1378,8 @@ namespace tvj
 		return false;
 	}
 
-	template<typename Elem>
-	size_t forward_list<Elem>::count(const Elem& elem) const noexcept
+	template<typename Elem, typename Alloc>
+	size_t forward_list<Elem, Alloc>::count(const Elem& elem) const noexcept
 	{
 		size_t count = 0;
 		for (const auto elem_ : *this)
@@ -860,8 +1389,8 @@ namespace tvj
 		return count;
 	}
 
-	template<typename Elem>
-	void forward_list<Elem>::assign(const const_iterator& iter, const Elem& elem)
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::assign(const const_iterator& iter, const Elem& elem)
 	{
 #ifndef NDEBUG
 		if (!iter.node)        error_info("Null pointer of 'iter' in function assign of tvj::forward_list.", TVJ_FORWARD_LIST_NULLPTR);
@@ -871,14 +1400,14 @@ namespace tvj
 		iter.node->data = elem;
 	}
 
-	template<typename Elem>
-	void forward_list<Elem>::insert_after(const const_iterator& iter, const Elem& elem)
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::insert_after(const const_iterator& iter, const Elem& elem)
 	{
 		insert_after(iter, elem, 1);
 	}
 
-	template<typename Elem>
-	void forward_list<Elem>::insert_after(const const_iterator& iter, const Elem& elem, size_t n)
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::insert_after(const const_iterator& iter, const Elem& elem, size_t n)
 	{
 		if (n == 0) return;
 		for (const_iterator i = cbefore_begin(); (i + 1) != cend(); i++)
@@ -887,7 +1416,7 @@ namespace tvj
 			{
 				for (size_t j = 0; j != n; j++)
 				{
-					Node* new_node = new Node(elem, i.node->succ);
+					Node* new_node = _create_node(elem, i.node->succ);
 					i.node->succ = new_node;
 					i++;
 					size_++;
@@ -899,24 +1428,24 @@ namespace tvj
 		for (size_t j = 0; j != n; j++) push_back(elem);
 	}
 
-	template<typename Elem>
-	void forward_list<Elem>::push_back(const Elem& elem)
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::push_back(const Elem& elem)
 	{
 		tail->data = elem;
-		tail->succ = new Node;
+		tail->succ = _create_node();
 		tail = tail->succ;
 		tail->succ = nullptr;
 		size_++;
 	}
 
-	template<typename Elem>
-	void forward_list<Elem>::push_front(const Elem& elem)
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::push_front(const Elem& elem)
 	{
 		insert_after(const_iterator(head, this), elem);
 	}
 
-	template<typename Elem>
-	void forward_list<Elem>::pop_back()
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::pop_back()
 	{
 		auto i = cbefore_begin();
 		if (empty()) return;
@@ -926,27 +1455,31 @@ namespace tvj
 		}
 		auto tmp = i.node->succ;
 		i.node->succ = tail;
-		if (tmp) delete tmp;
+		if (tmp) _destroy_node(tmp);
 		size_--;
 	}
 
-	template<typename Elem>
-	void forward_list<Elem>::pop_front()
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::pop_front()
 	{
 		if (empty()) return;
+		auto old_head = head;
 		head = head->succ;
+		_destroy_node(old_head);
 		size_--;
 	}
 
-	template<typename Elem>
-	Elem forward_list<Elem>::remove_at(const const_iterator& iter, bool* ok)
+	template<typename Elem, typename Alloc>
+	Elem forward_list<Elem, Alloc>::remove_at(const const_iterator& iter, bool* ok)
 	{
 		if (ok) *ok = false;
 		for (auto i = cbefore_begin(); (i + 1) != cend(); i++)
 		{
 			if (i + 1 != iter) continue;
 			Elem ret = *(i + 1);
-			i.node->succ = (i + 1).node->succ;
+			auto to_delete = i.node->succ;
+			i.node->succ = to_delete->succ;
+			_destroy_node(to_delete);
 			size_--;
 			if (ok) *ok = true;
 			return ret;
@@ -954,8 +1487,8 @@ namespace tvj
 		return tail->data;
 	}
 
-	template<typename Elem>
-	void forward_list<Elem>::erase_after(const const_iterator& iter1)
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::erase_after(const const_iterator& iter1)
 	{
 		if (empty()) return;
 		const_iterator iter2 = cend();
@@ -969,7 +1502,7 @@ namespace tvj
 				auto to_delete = j.node;
 				++j;
 #ifdef NDEBUG
-				if (to_delete) delete to_delete;
+				if (to_delete) _destroy_node(to_delete);
 #endif
 				tmp_size++;
 			}
@@ -979,8 +1512,8 @@ namespace tvj
 		}
 	}
 
-	template<typename Elem>
-	void forward_list<Elem>::erase_after(const const_iterator& iter1, const const_iterator& iter2)
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::erase_after(const const_iterator& iter1, const const_iterator& iter2)
 	{
 		if (empty()) return;
 		for (auto i = cbefore_begin(); i + 1 != cend(); i++)
@@ -993,7 +1526,7 @@ namespace tvj
 				auto to_delete = j.node;
 				++j;
 #ifdef NDEBUG
-				if (to_delete) delete to_delete;
+				if (to_delete) _destroy_node(to_delete);
 #endif
 				tmp_size++;
 			}
@@ -1003,8 +1536,8 @@ namespace tvj
 		}
 	}
 
-	template<typename Elem>
-	void forward_list<Elem>::unique()
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::unique()
 	{
 		if (size_ < 2) return;
 
@@ -1019,34 +1552,100 @@ namespace tvj
 			{
 				auto tmp = (i + 1).node;
 				i.node->succ = (i + 2).node->succ;
-				delete tmp;
+				_destroy_node(tmp);
 				size_--;
 			}
 		}
 		if (*i == *(i + 1)) pop_back();
 	}
 
-	template<typename Elem>
-	void forward_list<Elem>::link(const forward_list& list_)
+	template<typename Elem, typename Alloc>
+	size_t forward_list<Elem, Alloc>::_splice_after(Node* pos, const forward_list& list_, Node* first, Node* last)
+	{
+#ifndef NDEBUG
+		if (!pos)                 error_info("Null pointer of 'iter' in function splice_after of tvj::forward_list.", TVJ_FORWARD_LIST_NULLPTR);
+		if (pos == tail)          error_info("Overflow of 'iter' in function splice_after of tvj::forward_list.", TVJ_FORWARD_LIST_OVERFLOW);
+		if (!(alloc_ == list_.alloc_))
+			error_info("Splice between tvj::forward_list with unequal allocators.", TVJ_FORWARD_LIST_TYPE_MISMATCH);
+#else
+		static_cast<void>(list_);
+#endif
+		if (first == last || first->succ == last) return 0;
+
+		// the chain (first, last) is [front, back]
+		size_t n = 1;
+		auto front = first->succ;
+		auto back = front;
+		while (back->succ != last)
+		{
+			back = back->succ;
+			n++;
+		}
+		first->succ = last;
+		back->succ = pos->succ;
+		pos->succ = front;
+		return n;
+	}
+
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::splice_after(const const_iterator& iter, forward_list& list_)
+	{
+		if (&list_ == this) return;
+		const auto n = _splice_after(iter.node, list_, list_.head, list_.tail);
+		size_ += n;
+		list_.size_ -= n;
+	}
+
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::splice_after(const const_iterator& iter, forward_list& list_, const const_iterator& iter_)
+	{
+#ifndef NDEBUG
+		if (!iter_.node || iter_.node == list_.tail || iter_.node->succ == list_.tail)
+			error_info("Overflow of 'iter_' in function splice_after of tvj::forward_list.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		if (iter.node == iter_.node || iter.node == iter_.node->succ) return;
+		const auto n = _splice_after(iter.node, list_, iter_.node, iter_.node->succ->succ);
+		if (&list_ == this) return;
+		size_ += n;
+		list_.size_ -= n;
+	}
+
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::splice_after(const const_iterator& iter, forward_list& list_, const const_iterator& first, const const_iterator& last)
+	{
+		const auto n = _splice_after(iter.node, list_, first.node, last.node);
+		if (&list_ == this) return;
+		size_ += n;
+		list_.size_ -= n;
+	}
+
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::link(const forward_list& list_)
 	{
 		if (list_.empty()) return;
 
 		// copy the list first otherwise it uses nodes in list_ which is unsafe
-		forward_list<Elem> new_list = list_;
+		forward_list<Elem, Alloc> new_list(list_, alloc_);
 
-		size_ += list_.size_;
-		this->tail->data = new_list.head->succ->data;
-		this->tail->succ = new_list.head->succ->succ;
+		auto first = new_list.head->succ;
+		size_ += new_list.size_;
+		this->tail->data = first->data;
+		this->tail->succ = first->succ;
 		this->tail = new_list.tail;
+
+		// the first node becomes the tail of new_list so that it only releases its own nodes
+		first->succ = nullptr;
+		new_list.tail = first;
+		new_list.size_ = 0;
 	}
 
-	template<typename Elem>
-	void forward_list<Elem>::merge(const forward_list& list_, bool is_ascending)
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::merge(const forward_list& list_, bool is_ascending)
 	{
 		if (list_.empty()) return;
 
 		// copy the list first otherwise it uses nodes in list_ which is unsafe
-		forward_list<Elem> new_list = list_;
+		forward_list<Elem, Alloc> new_list(list_, alloc_);
 
 #ifndef NDEBUG		
 		if (!this->sorted(is_ascending))    this->sort(is_ascending);
@@ -1071,7 +1670,9 @@ namespace tvj
 			{
 				h = h->succ = i;
 				i = i->succ;
+				auto duplicate = j;
 				j = j->succ;
+				_destroy_node(duplicate);
 				label = true;
 			}
 			else if ((i->data < j->data) ^ !is_ascending)
@@ -1101,12 +1702,16 @@ namespace tvj
 			label = false;
 			new_size++;
 		}
-		tail = h->succ;
+		h->succ = tail;
 		size_ = new_size;
+
+		// all the nodes of new_list have been used
+		new_list.head->succ = new_list.tail;
+		new_list.size_ = 0;
 	}
 
-	template<typename Elem>
-	typename forward_list<Elem>::Node* forward_list<Elem>::_inplace_merge(Node* first_, Node* mid_, Node* last_, bool is_ascending)
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::Node* forward_list<Elem, Alloc>::_inplace_merge(Node* first_, Node* mid_, Node* last_, bool is_ascending)
 	{
 		auto	 i = first_->succ;
 		auto j = mid_->succ;
@@ -1139,8 +1744,8 @@ namespace tvj
 		return (last_->data < mid_->data) ^ !is_ascending ? mid_ : last_;
 	}
 
-	template<typename Elem>
-	typename forward_list<Elem>::Node* forward_list<Elem>::_sort2(Node* first, bool is_ascending)
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::Node* forward_list<Elem, Alloc>::_sort2(Node* first, bool is_ascending)
 	{
 		if (is_ascending ^ (first->succ->data < first->succ->succ->data))
 		{
@@ -1151,8 +1756,8 @@ namespace tvj
 		return first->succ->succ;
 	}
 
-	template<typename Elem>
-	typename forward_list<Elem>::Node* forward_list<Elem>::_sort(Node* first, size_t bound, bool is_ascending)
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::Node* forward_list<Elem, Alloc>::_sort(Node* first, size_t bound, bool is_ascending)
 	{
 		if (bound == 0) return nullptr;
 		if (bound == 1) return first->succ;
@@ -1163,11 +1768,524 @@ namespace tvj
 		return _inplace_merge(first, mid_node, last_node, is_ascending);
 	}
 
-	template<typename Elem>
-	void forward_list<Elem>::sort(bool is_ascending)
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::sort(bool is_ascending)
 	{
 		_sort(head, size_, is_ascending);
 	}
+
+	template<typename Elem, typename Alloc>
+	bool forward_list<Elem, Alloc>::_keep_stage::operator()(Elem&) const noexcept
+	{
+		return true;
+	}
+
+	template<typename Elem, typename Alloc> template<typename Stage, typename Transform>
+	bool forward_list<Elem, Alloc>::_transform_stage<Stage, Transform>::operator()(Elem& elem)
+	{
+		if (!stage(elem)) return false;
+		fn(elem);
+		return true;
+	}
+
+	template<typename Elem, typename Alloc> template<typename Stage, typename Predicate>
+	bool forward_list<Elem, Alloc>::_filter_stage<Stage, Predicate>::operator()(Elem& elem)
+	{
+		return stage(elem) && pred(static_cast<const Elem&>(elem));
+	}
+
+	template<typename Elem, typename Alloc> template<typename Stage>
+	size_t forward_list<Elem, Alloc>::_apply_inplace(Stage& stage)
+	{
+		size_t removed = 0;
+		auto pre = head;
+		auto cur = head->succ;
+		while (cur != tail)
+		{
+			iterator iter(cur, this);
+			if (stage(*iter))
+			{
+				pre = cur;
+			}
+			else
+			{
+				// size_ is kept exact in case a later stage throws
+				pre->succ = cur->succ;
+				_destroy_node(cur);
+				size_--;
+				removed++;
+			}
+			cur = pre->succ;
+		}
+		return removed;
+	}
+
+	template<typename Elem, typename Alloc> template<typename Stage>
+	forward_list<Elem, Alloc>::pipeline<Stage>::pipeline(forward_list<Elem, Alloc>* list_, const Stage& stage_) : list(list_), stage(stage_) { }
+
+	template<typename Elem, typename Alloc> template<typename Stage> template<typename Transform>
+	typename forward_list<Elem, Alloc>::template pipeline<typename forward_list<Elem, Alloc>::template _transform_stage<Stage, Transform>>
+		forward_list<Elem, Alloc>::pipeline<Stage>::transform(Transform fn) const
+	{
+		return pipeline<_transform_stage<Stage, Transform>>(list, _transform_stage<Stage, Transform>{ stage, fn });
+	}
+
+	template<typename Elem, typename Alloc> template<typename Stage> template<typename Predicate>
+	typename forward_list<Elem, Alloc>::template pipeline<typename forward_list<Elem, Alloc>::template _filter_stage<Stage, Predicate>>
+		forward_list<Elem, Alloc>::pipeline<Stage>::filter(Predicate pred) const
+	{
+		return pipeline<_filter_stage<Stage, Predicate>>(list, _filter_stage<Stage, Predicate>{ stage, pred });
+	}
+
+	template<typename Elem, typename Alloc> template<typename Stage>
+	size_t forward_list<Elem, Alloc>::pipeline<Stage>::run()
+	{
+		return list->_apply_inplace(stage);
+	}
+
+	template<typename Elem, typename Alloc> template<typename Transform, typename Predicate>
+	size_t forward_list<Elem, Alloc>::transform_filter_inplace(Transform fn, Predicate pred)
+	{
+		_filter_stage<_transform_stage<_keep_stage, Transform>, Predicate> stage{ { _keep_stage(), fn }, pred };
+		return _apply_inplace(stage);
+	}
+
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::template pipeline<typename forward_list<Elem, Alloc>::_keep_stage> forward_list<Elem, Alloc>::inplace_pipeline() noexcept
+	{
+		return pipeline<_keep_stage>(this, _keep_stage());
+	}
+
+	template<typename Elem, typename Alloc> template<typename Predicate>
+	typename forward_list<Elem, Alloc>::iterator forward_list<Elem, Alloc>::partition(Predicate pred)
+	{
+		auto boundary = head; // the last node of the first part
+		auto pre = head;
+		auto cur = head->succ;
+		while (cur != tail)
+		{
+			if (pred(static_cast<const Elem&>(cur->data)))
+			{
+				if (pre == boundary)
+				{
+					boundary = pre = cur;
+				}
+				else
+				{
+					pre->succ = cur->succ;
+					cur->succ = boundary->succ;
+					boundary = boundary->succ = cur;
+				}
+			}
+			else
+			{
+				pre = cur;
+			}
+			cur = pre->succ;
+		}
+		return iterator(boundary->succ, this);
+	}
+
+	template<typename Elem, typename Alloc> template<typename Predicate>
+	typename forward_list<Elem, Alloc>::iterator forward_list<Elem, Alloc>::stable_partition(Predicate pred)
+	{
+		auto h = head;
+		Node* first_2 = nullptr;
+		Node* last_2 = nullptr;
+		for (auto cur = head->succ; cur != tail; cur = cur->succ)
+		{
+			if (pred(static_cast<const Elem&>(cur->data)))
+			{
+				h = h->succ = cur;
+			}
+			else
+			{
+				if (last_2) last_2->succ = cur;
+				else        first_2 = cur;
+				last_2 = cur;
+			}
+		}
+		if (last_2)
+		{
+			h->succ = first_2;
+			last_2->succ = tail;
+			return iterator(first_2, this);
+		}
+		h->succ = tail;
+		return end();
+	}
+
+	template<typename Elem, typename Alloc> template<typename Predicate>
+	size_t forward_list<Elem, Alloc>::partition_into(Predicate pred, forward_list& list_)
+	{
+		if (&list_ == this) return 0;
+		if (!(alloc_ == list_.alloc_))
+		{
+			// the nodes cannot be freed by the allocator of list_, so they are relinked into
+			// a list with this allocator and the elements are copied from there
+			forward_list<Elem, Alloc> rest(alloc_);
+			const auto moved = partition_into(pred, rest);
+			for (const auto& elem : rest) list_.push_back(elem);
+			return moved;
+		}
+
+		// the last node of list_ before its tail
+		auto h = list_.head;
+		while (h->succ != list_.tail) h = h->succ;
+
+		size_t moved = 0;
+		auto pre = head;
+		auto cur = head->succ;
+		try
+		{
+			while (cur != tail)
+			{
+				if (pred(static_cast<const Elem&>(cur->data)))
+				{
+					pre = cur;
+				}
+				else
+				{
+					pre->succ = cur->succ;
+					h = h->succ = cur;
+					moved++;
+				}
+				cur = pre->succ;
+			}
+		}
+		catch (...)
+		{
+			// keep the nodes moved so far in list_
+			h->succ = list_.tail;
+			size_ -= moved;
+			list_.size_ += moved;
+			throw;
+		}
+		h->succ = list_.tail;
+		size_ -= moved;
+		list_.size_ += moved;
+		return moved;
+	}
+
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::partial_sort(size_t k, bool is_ascending)
+	{
+		if (k > size_) k = size_;
+		if (k == 0) return;
+
+		// bounded heap of the nodes with their positions, the top is the last one kept,
+		// ties are broken by the position so that later equal elements are dropped first
+		typedef std::pair<size_t, Node*> Entry;
+		_order order{ is_ascending };
+		auto heap_comp = [&order](const Entry& a, const Entry& b)
+		{
+			if (order(a.second->data, b.second->data)) return true;
+			if (order(b.second->data, a.second->data)) return false;
+			return a.first < b.first;
+		};
+		std::vector<Entry> heap;
+		heap.reserve(k);
+		size_t pos = 0;
+		for (auto cur = head->succ; cur != tail; cur = cur->succ, pos++)
+		{
+			if (heap.size() < k)
+			{
+				heap.emplace_back(pos, cur);
+				std::push_heap(heap.begin(), heap.end(), heap_comp);
+			}
+			else if (order(cur->data, heap.front().second->data))
+			{
+				std::pop_heap(heap.begin(), heap.end(), heap_comp);
+				heap.back() = Entry(pos, cur);
+				std::push_heap(heap.begin(), heap.end(), heap_comp);
+			}
+		}
+
+		// unlink the selected nodes into a chain in their list order, the others keep their order
+		std::sort(heap.begin(), heap.end(), [](const Entry& a, const Entry& b) { return a.first < b.first; });
+		Node* selected = nullptr;
+		Node** link = &selected;
+		auto pre = head;
+		auto next = heap.begin();
+		pos = 0;
+		for (auto cur = head->succ; next != heap.end(); cur = pre->succ, pos++)
+		{
+			if (pos == next->first)
+			{
+				pre->succ = cur->succ;
+				*link = cur;
+				link = &cur->succ;
+				++next;
+			}
+			else
+			{
+				pre = cur;
+			}
+		}
+		*link = nullptr;
+
+		// sort the chain (stable) and link it at the front
+		auto rest = head->succ;
+		auto h = head;
+		h->succ = _chain::sort(selected, k, order);
+		while (h->succ) h = h->succ;
+		h->succ = rest;
+	}
+
+	template<typename Elem, typename Alloc>
+	typename forward_list<Elem, Alloc>::iterator forward_list<Elem, Alloc>::nth_element(size_t n, bool is_ascending)
+	{
+		if (n >= size_) return end();
+
+		_order order{ is_ascending };
+		auto pre = head;  // the node before the current range
+		auto len = size_; // the length of the current range
+		unsigned long long seed = 0x9E3779B97F4A7C15ULL ^ size_;
+		while (len > 1)
+		{
+			// pick a pseudo random pivot (xorshift)
+			seed ^= seed << 13;
+			seed ^= seed >> 7;
+			seed ^= seed << 17;
+			auto pivot = pre->succ;
+			for (auto i = seed % len; i != 0; i--) pivot = pivot->succ;
+
+			// split the range into three chains: less, equal and greater than the pivot
+			Node* first[3] = { nullptr, nullptr, nullptr };
+			Node* last[3]  = { nullptr, nullptr, nullptr };
+			size_t count[3] = { 0, 0, 0 };
+			auto cur = pre->succ;
+			for (size_t i = 0; i != len; i++)
+			{
+				const int part = order(cur->data, pivot->data) ? 0 : order(pivot->data, cur->data) ? 2 : 1;
+				if (last[part]) last[part]->succ = cur;
+				else            first[part] = cur;
+				last[part] = cur;
+				count[part]++;
+				cur = cur->succ;
+			}
+
+			// relink them in order between pre and the rest
+			auto h = pre;
+			for (int part = 0; part != 3; part++)
+			{
+				if (!first[part]) continue;
+				h->succ = first[part];
+				h = last[part];
+			}
+			h->succ = cur;
+
+			if (n < count[0])
+			{
+				len = count[0];
+			}
+			else if (n < count[0] + count[1])
+			{
+				return iterator(first[1], this);
+			}
+			else
+			{
+				pre = last[1];
+				n -= count[0] + count[1];
+				len = count[2];
+			}
+		}
+		return iterator(pre->succ, this);
+	}
+
+	template<typename Elem, typename Alloc> template<typename Projection>
+	void forward_list<Elem, Alloc>::sort_by_key(Projection proj, bool is_ascending)
+	{
+		if (size_ < 2) return;
+
+		typedef typename std::decay<decltype(proj(std::declval<const Elem&>()))>::type Key;
+		std::vector<std::pair<Key, Node*>> keyed;
+		keyed.reserve(size_);
+		for (auto cur = head->succ; cur != tail; cur = cur->succ)
+		{
+			keyed.emplace_back(proj(static_cast<const Elem&>(cur->data)), cur);
+		}
+
+		_order order{ is_ascending };
+		std::stable_sort(keyed.begin(), keyed.end(),
+			[&order](const std::pair<Key, Node*>& a, const std::pair<Key, Node*>& b) { return order(a.first, b.first); });
+
+		auto h = head;
+		for (const auto& item : keyed) h = h->succ = item.second;
+		h->succ = tail;
+	}
+
+	template<typename Elem, typename Alloc> template<typename Projection>
+	void forward_list<Elem, Alloc>::merge_by_key(forward_list& list_, Projection proj, bool is_ascending)
+	{
+		if (&list_ == this || list_.empty()) return;
+		if (!(alloc_ == list_.alloc_))
+		{
+			// the nodes cannot be freed by this allocator, so a copy made with it is merged instead
+			forward_list<Elem, Alloc> copy(list_, alloc_);
+			merge_by_key(copy, proj, is_ascending);
+			list_.clear();
+			return;
+		}
+
+		typedef typename std::decay<decltype(proj(std::declval<const Elem&>()))>::type Key;
+		_order order{ is_ascending };
+		auto i = head->succ;
+		auto j = list_.head->succ;
+		auto h = head;
+		size_t taken = 0; // the nodes relinked from list_
+
+		if (i != tail)
+		{
+			try
+			{
+				// the cached keys of the current nodes i and j
+				Key key_i = proj(static_cast<const Elem&>(i->data));
+				Key key_j = proj(static_cast<const Elem&>(j->data));
+				while (true)
+				{
+					if (order(key_j, key_i))
+					{
+						h = h->succ = j;
+						j = j->succ;
+						taken++;
+						if (j == list_.tail) break;
+						key_j = proj(static_cast<const Elem&>(j->data));
+					}
+					else
+					{
+						h = h->succ = i;
+						i = i->succ;
+						if (i == tail) break;
+						key_i = proj(static_cast<const Elem&>(i->data));
+					}
+				}
+			}
+			catch (...)
+			{
+				// keep the merged part and the rest of *this, the other nodes stay in list_
+				h->succ = i;
+				list_.head->succ = j;
+				size_ += taken;
+				list_.size_ -= taken;
+				throw;
+			}
+		}
+
+		// link the rest
+		if (i != tail)
+		{
+			h->succ = i;
+		}
+		else
+		{
+			h->succ = j;
+			while (h->succ != list_.tail) h = h->succ;
+			h->succ = tail;
+		}
+
+		size_ += list_.size_;
+		list_.size_ = 0;
+		list_.head->succ = list_.tail;
+	}
+
+	template<typename Elem, typename Alloc>
+	bool forward_list<Elem, Alloc>::_suffix_order::operator()(const Elem& a, const Elem& b) const
+	{
+		const auto c = a.compare(depth, Elem::npos, b, depth, Elem::npos);
+		return is_ascending ? c < 0 : c > 0;
+	}
+
+	template<typename Elem, typename Alloc>
+	void forward_list<Elem, Alloc>::radix_sort(bool is_ascending)
+	{
+		static_assert(std::is_same<Elem, std::string>::value, "radix_sort of tvj::forward_list requires std::string elements.");
+		if (size_ < 2) return;
+
+		const size_t small_bucket = 32;
+
+		// a bucket still to be sorted from the depth, or one to be linked as it is
+		struct Bucket
+		{
+			Node*  first;
+			size_t n;
+			size_t depth;
+			bool   done;
+		};
+		std::vector<Bucket> stack;
+		stack.push_back(Bucket{ head->succ, size_, 0, false });
+
+		// bucket 0 is for the strings that end at the depth, bucket c + 1 for byte c
+		Node*  first[257];
+		Node*  last[257];
+		size_t count[257];
+
+		auto h = head;
+		while (!stack.empty())
+		{
+			const auto bucket = stack.back();
+			stack.pop_back();
+
+			if (bucket.done || bucket.n < 2)
+			{
+				h->succ = bucket.first;
+				for (size_t i = 1; i < bucket.n; i++) h = h->succ;
+				if (bucket.n) h = h->succ;
+				continue;
+			}
+			if (bucket.n < small_bucket)
+			{
+				_suffix_order order{ bucket.depth, is_ascending };
+				auto rest = bucket.first;
+				h->succ = _chain::sort(rest, bucket.n, order);
+				while (h->succ) h = h->succ;
+				continue;
+			}
+
+			std::fill(first, first + 257, nullptr);
+			std::fill(count, count + 257, 0);
+			auto cur = bucket.first;
+			for (size_t i = 0; i != bucket.n; i++)
+			{
+				const auto& str = cur->data;
+				const size_t b = str.size() == bucket.depth ? 0 : static_cast<unsigned char>(str[bucket.depth]) + 1;
+				if (first[b]) last[b]->succ = cur;
+				else          first[b] = cur;
+				last[b] = cur;
+				count[b]++;
+				cur = cur->succ;
+			}
+
+			// the top of the stack is linked first
+			if (is_ascending)
+			{
+				for (size_t b = 256; b != 0; b--)
+				{
+					if (count[b]) stack.push_back(Bucket{ first[b], count[b], bucket.depth + 1, false });
+				}
+				if (count[0]) stack.push_back(Bucket{ first[0], count[0], bucket.depth, true });
+			}
+			else
+			{
+				if (count[0]) stack.push_back(Bucket{ first[0], count[0], bucket.depth, true });
+				for (size_t b = 1; b != 257; b++)
+				{
+					if (count[b]) stack.push_back(Bucket{ first[b], count[b], bucket.depth + 1, false });
+				}
+			}
+		}
+		h->succ = tail;
+	}
+
+#ifdef TVJ_FORWARD_LIST_PMR
+	namespace pmr
+	{
+		// tvj::forward_list using std::pmr::polymorphic_allocator,
+		// lists of the same type can draw nodes from different memory resources
+		template<typename Elem>
+		using forward_list = tvj::forward_list<Elem, std::pmr::polymorphic_allocator<Elem>>;
+	}
+#endif
 };
 
 // ALL RIGHTS RESERVED (C) 2021 Teddy van Jerry
\ No newline at end of file
@@ -0,0 +1,188 @@
+/*
+ * File: TVJ_Hugepage_Slab.h
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+#include "TVJ_Node_Pool.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#define TVJ_HUGEPAGE_SLAB_MMAP
+#endif
+
+namespace tvj
+{
+	// how the memory of tvj::hugepage_slab is reserved
+	enum TVJ_HUGEPAGE_MODE
+	{
+		TVJ_HUGEPAGE_TRANSPARENT, // mmap with MADV_HUGEPAGE (transparent huge pages)
+		TVJ_HUGEPAGE_HUGETLB,     // mmap with MAP_HUGETLB, then transparent huge pages if it fails
+		TVJ_HUGEPAGE_NONE         // regular pages
+	};
+
+	// The slab of fixed-size blocks (the node size) reserved in huge-page regions
+	// so that the nodes of giant lists are packed into few TLB entries,
+	// the blocks are only touched when they are carved.
+	class hugepage_slab : public block_free_list<hugepage_slab>
+	{
+		friend class block_free_list<hugepage_slab>;
+
+	protected:
+		// a region reserved from the system
+		struct Region
+		{
+			void*  ptr;
+			size_t bytes;
+			bool   mapped; // reserved by mmap rather than ::operator new
+		};
+
+		static constexpr size_t huge_page_size = 2 * 1024 * 1024;
+
+	private:
+		std::vector<Region> regions;
+		size_t            region_size;
+		TVJ_HUGEPAGE_MODE mode;
+		size_t            huge_regions = 0; // regions backed (or advised to be backed) by huge pages
+
+		// reserve a new region and carve from it
+		void _grow();
+
+	public:
+		/**
+		 * brief: constructor
+		 * param: the region size in bytes (rounded up to 2 MiB), the way to reserve memory
+		 * return: --
+		 */
+		explicit hugepage_slab(size_t region_size_ = 64 * huge_page_size, TVJ_HUGEPAGE_MODE mode_ = TVJ_HUGEPAGE_TRANSPARENT);
+
+		/**
+		 * brief: destructor, all regions are returned to the system
+		 * param: (void)
+		 * return: --
+		 */
+		~hugepage_slab();
+
+		/**
+		 * brief: the bytes reserved from the system
+		 * param: (void)
+		 * return: size_t
+		 */
+		size_t reserved() const noexcept;
+
+		/**
+		 * brief: the number of regions backed (or advised to be backed) by huge pages
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t huge_page_regions() const noexcept;
+	};
+
+	// the allocator binding containers to a tvj::hugepage_slab
+	template<typename T>
+	using hugepage_slab_allocator = block_allocator<T, hugepage_slab>;
+
+	// tvj::forward_list whose nodes come from a tvj::hugepage_slab
+	template<typename Elem>
+	using hugepage_forward_list = forward_list<Elem, hugepage_slab_allocator<Elem>>;
+
+	inline void hugepage_slab::_grow()
+	{
+		Region region{ nullptr, region_size, false };
+		bool huge = false;
+#ifdef TVJ_HUGEPAGE_SLAB_MMAP
+#ifdef MAP_HUGETLB
+		if (mode == TVJ_HUGEPAGE_HUGETLB)
+		{
+			auto ptr = mmap(nullptr, region_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+			if (ptr != MAP_FAILED)
+			{
+				region.ptr = ptr;
+				region.mapped = true;
+				huge = true;
+			}
+		}
+#endif
+		if (!region.ptr && mode != TVJ_HUGEPAGE_NONE)
+		{
+			// map one more huge page and trim it so that the region is aligned to huge pages
+			auto ptr = mmap(nullptr, region_size + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (ptr != MAP_FAILED)
+			{
+				const auto start   = reinterpret_cast<std::uintptr_t>(ptr);
+				const auto aligned = (start + huge_page_size - 1) & ~static_cast<std::uintptr_t>(huge_page_size - 1);
+				const auto tail    = start + huge_page_size - aligned;
+				if (aligned != start) munmap(ptr, aligned - start);
+				if (tail)             munmap(reinterpret_cast<void*>(aligned + region_size), tail);
+				region.ptr = reinterpret_cast<void*>(aligned);
+				region.mapped = true;
+#ifdef MADV_HUGEPAGE
+				huge = madvise(region.ptr, region_size, MADV_HUGEPAGE) == 0;
+#endif
+			}
+		}
+		if (!region.ptr && mode == TVJ_HUGEPAGE_NONE)
+		{
+			auto ptr = mmap(nullptr, region_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (ptr != MAP_FAILED)
+			{
+				region.ptr = ptr;
+				region.mapped = true;
+			}
+		}
+#endif
+		// regular pages
+		if (!region.ptr) region.ptr = ::operator new(region_size);
+
+		regions.push_back(region);
+		if (huge) huge_regions++;
+		_carve_from(region.ptr, region_size);
+	}
+
+	inline hugepage_slab::hugepage_slab(size_t region_size_, TVJ_HUGEPAGE_MODE mode_)
+		: region_size((region_size_ + huge_page_size - 1) / huge_page_size * huge_page_size), mode(mode_)
+	{
+		if (!region_size) region_size = huge_page_size;
+	}
+
+	inline hugepage_slab::~hugepage_slab()
+	{
+		for (const auto& region : regions)
+		{
+#ifdef TVJ_HUGEPAGE_SLAB_MMAP
+			if (region.mapped)
+			{
+				munmap(region.ptr, region.bytes);
+				continue;
+			}
+#endif
+			::operator delete(region.ptr);
+		}
+	}
+
+	inline size_t hugepage_slab::reserved() const noexcept
+	{
+		return regions.size() * region_size;
+	}
+
+	size_t hugepage_slab::huge_page_regions() const noexcept
+	{
+		return huge_regions;
+	}
+};
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
@@ -0,0 +1,422 @@
+/*
+ * File: TVJ_LRU_Cache.h
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <utility>
+#include "TVJ_Node_Pool.h"
+#include "TVJ_Unordered_Map.h"
+
+namespace tvj
+{
+	// The tvj::lru_cache class
+	// that keeps the entries in a singly linked list from the least to the most recently used,
+	// and maps each key to the predecessor of its node so that a node is unlinked in O(1).
+	// The nodes come from a tvj::fixed_block_pool owned by the cache.
+	template<typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+	class lru_cache
+	{
+	protected:
+		// the link of a node (the head sentinel only has the link)
+		struct Link
+		{
+			Link* succ = nullptr;
+		};
+
+		// the class of the cache node
+		struct Node : Link
+		{
+			template<typename V>
+			Node(const Key& key_, V&& value_);
+			Key   key;
+			Value value;
+		};
+
+		// unlink the node after pred and fix the predecessor of its successor
+		void _unlink(Link* pred);
+
+		// link the node at the end (most recently used)
+		void _link_back(Node* node) noexcept;
+
+		// destroy a node and return it to the pool
+		void _destroy_node(Node* node) noexcept;
+
+	private:
+		fixed_block_pool pool;
+		unordered_map<Key, Link*, Hash, KeyEqual> index; // the key to the predecessor of its node
+		Link   head;                                       // before the least recently used
+		Link*  tail = &head;                               // the most recently used (&head if empty)
+		size_t capacity_;
+		size_t batch;
+
+	public:
+		/**
+		 * brief: constructor
+		 * param: the capacity, the number of entries evicted at once when it is full
+		 * return: --
+		 */
+		explicit lru_cache(size_t capacity, size_t evict_batch = 1);
+
+		lru_cache(const lru_cache&) = delete;
+		lru_cache& operator=(const lru_cache&) = delete;
+
+		/**
+		 * @brief: destructor
+		 * @param: (void)
+		 * @return: --
+		 */
+		~lru_cache();
+
+		/**
+		 * brief: the value of the key which becomes the most recently used
+		 * param: the key
+		 * return: Value* (nullptr if not found)
+		 */
+		Value* get(const Key& key);
+
+		/**
+		 * brief: the value of the key without changing the order
+		 * param: the key
+		 * return: const Value* (nullptr if not found)
+		 */
+		const Value* peek(const Key& key) const;
+
+		/**
+		 * brief: insert or update the value of the key which becomes the most recently used,
+		 *        a batch of the least recently used entries is evicted if it is full
+		 * param: the key, the value
+		 * return: void
+		 */
+		template<typename V>
+		void put(const Key& key, V&& value);
+
+		/**
+		 * brief: erase the entry of the key
+		 * param: the key
+		 * return: bool (whether it is found)
+		 */
+		bool erase(const Key& key);
+
+		/**
+		 * brief: evict the least recently used entries
+		 * param: the number of entries
+		 * return: size_t (number of evicted entries)
+		 */
+		size_t evict(size_t n = 1);
+
+		/**
+		 * brief: evict the least recently used entries and pass them to the function before
+		 * param: the number of entries, the function called with (const Key&, Value&)
+		 * return: size_t (number of evicted entries)
+		 */
+		template<typename Function>
+		size_t evict(size_t n, Function fn);
+
+		/**
+		 * brief: check whether the cache contains the key
+		 * param: the key
+		 * return: bool
+		 */
+		inline bool contains(const Key& key) const;
+
+		/**
+		 * brief: the number of entries
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t size() const noexcept;
+
+		/**
+		 * brief: if the cache is empty
+		 * param: (void)
+		 * return: bool
+		 */
+		inline bool empty() const noexcept;
+
+		/**
+		 * brief: the capacity
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t capacity() const noexcept;
+
+		/**
+		 * brief: remove all entries
+		 * param: (void)
+		 * return: void
+		 */
+		void clear() noexcept;
+
+		/**
+		 * brief: visit the entries from the least to the most recently used
+		 * param: the function called with (const Key&, const Value&)
+		 * return: void
+		 */
+		template<typename Function>
+		void for_each(Function fn) const;
+	};
+
+	template<typename Key, typename Value, typename Hash, typename KeyEqual> template<typename V>
+	lru_cache<Key, Value, Hash, KeyEqual>::Node::Node(const Key& key_, V&& value_) : key(key_), value(std::forward<V>(value_)) { }
+
+	template<typename Key, typename Value, typename Hash, typename KeyEqual>
+	void lru_cache<Key, Value, Hash, KeyEqual>::_unlink(Link* pred)
+	{
+		// the lookup (which may throw) comes before any link is changed
+		auto node = pred->succ;
+		if (node == tail) tail = pred;
+		else              index.find(static_cast<Node*>(node->succ)->key)->second = pred;
+		pred->succ = node->succ;
+		node->succ = nullptr;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename KeyEqual>
+	void lru_cache<Key, Value, Hash, KeyEqual>::_link_back(Node* node) noexcept
+	{
+		tail->succ = node;
+		tail = node;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename KeyEqual>
+	void lru_cache<Key, Value, Hash, KeyEqual>::_destroy_node(Node* node) noexcept
+	{
+		node->~Node();
+		pool.deallocate(node);
+	}
+
+	template<typename Key, typename Value, typename Hash, typename KeyEqual>
+	lru_cache<Key, Value, Hash, KeyEqual>::lru_cache(size_t capacity, size_t evict_batch)
+		: index(capacity), capacity_(capacity), batch(evict_batch ? evict_batch : 1) { }
+
+	template<typename Key, typename Value, typename Hash, typename KeyEqual>
+	lru_cache<Key, Value, Hash, KeyEqual>::~lru_cache()
+	{
+		clear();
+	}
+
+	template<typename Key, typename Value, typename Hash, typename KeyEqual>
+	Value* lru_cache<Key, Value, Hash, KeyEqual>::get(const Key& key)
+	{
+		auto iter = index.find(key);
+		if (iter == index.end()) return nullptr;
+		auto pred = iter->second;
+		auto node = static_cast<Node*>(pred->succ);
+		if (node != tail)
+		{
+			_unlink(pred);
+			iter->second = tail;
+			_link_back(node);
+		}
+		return &node->value;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename KeyEqual>
+	const Value* lru_cache<Key, Value, Hash, KeyEqual>::peek(const Key& key) const
+	{
+		auto iter = index.find(key);
+		if (iter == index.end()) return nullptr;
+		return &static_cast<const Node*>(iter->second->succ)->value;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename KeyEqual> template<typename V>
+	void lru_cache<Key, Value, Hash, KeyEqual>::put(const Key& key, V&& value)
+	{
+		if (auto found = get(key))
+		{
+			*found = std::forward<V>(value);
+			return;
+		}
+		if (index.size() >= capacity_) evict(index.size() + 1 - capacity_ > batch ? index.size() + 1 - capacity_ : batch);
+		if (!capacity_) return;
+
+		void* ptr = pool.allocate(sizeof(Node), alignof(Node));
+		Node* node;
+		try
+		{
+			node = ::new (ptr) Node(key, std::forward<V>(value));
+		}
+		catch (...)
+		{
+			pool.deallocate(ptr);
+			throw;
+		}
+		try
+		{
+			index.emplace(key, tail);
+		}
+		catch (...)
+		{
+			_destroy_node(node);
+			throw;
+		}
+		_link_back(node);
+	}
+
+	template<typename Key, typename Value, typename Hash, typename KeyEqual>
+	bool lru_cache<Key, Value, Hash, KeyEqual>::erase(const Key& key)
+	{
+		auto iter = index.find(key);
+		if (iter == index.end()) return false;
+		auto node = static_cast<Node*>(iter->second->succ);
+		_unlink(iter->second);
+		index.erase(iter);
+		_destroy_node(node);
+		return true;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename KeyEqual>
+	size_t lru_cache<Key, Value, Hash, KeyEqual>::evict(size_t n)
+	{
+		return evict(n, [](const Key&, Value&) { });
+	}
+
+	template<typename Key, typename Value, typename Hash, typename KeyEqual> template<typename Function>
+	size_t lru_cache<Key, Value, Hash, KeyEqual>::evict(size_t n, Function fn)
+	{
+		// the evicted nodes are cut from the front as one chain, only the new first node needs its predecessor fixed
+		size_t evicted = 0;
+		auto last = &head;
+		while (evicted != n && last->succ)
+		{
+			last = last->succ;
+			evicted++;
+		}
+		if (!evicted) return 0;
+		auto rest = last->succ;
+		auto next = rest ? index.find(static_cast<Node*>(rest)->key) : index.end(); // the lookup may throw before any change
+
+		// the chain is reversed and its keys are erased from the most recently used,
+		// so if Hash or KeyEqual throws, the rest is a prefix whose index entries are still valid
+		Link* reversed = nullptr;
+		for (auto node = head.succ; node != rest;)
+		{
+			auto succ = node->succ;
+			node->succ = reversed;
+			reversed = node;
+			node = succ;
+		}
+		Link* first = nullptr; // the erased nodes in the original order
+		try
+		{
+			while (reversed)
+			{
+				index.erase(static_cast<Node*>(reversed)->key);
+				auto succ = reversed->succ;
+				reversed->succ = first;
+				first = reversed;
+				reversed = succ;
+			}
+		}
+		catch (...)
+		{
+			// relink the nodes not erased in front of rest and destroy the erased ones
+			auto kept_last = reversed;
+			Link* kept = rest;
+			while (reversed)
+			{
+				auto succ = reversed->succ;
+				reversed->succ = kept;
+				kept = reversed;
+				reversed = succ;
+			}
+			if (next != index.end()) next->second = kept_last;
+			else                     tail = kept_last;
+			while (first)
+			{
+				auto node = static_cast<Node*>(first);
+				first = first->succ;
+				_destroy_node(node);
+			}
+			throw;
+		}
+		head.succ = rest;
+		if (next != index.end()) next->second = &head;
+		else                     tail = &head;
+
+		try
+		{
+			while (first)
+			{
+				auto node = static_cast<Node*>(first);
+				fn(const_cast<const Key&>(node->key), node->value);
+				first = first->succ;
+				_destroy_node(node);
+			}
+		}
+		catch (...)
+		{
+			// the cut nodes are no longer in the cache, so the rest of them is destroyed without fn
+			while (first)
+			{
+				auto node = static_cast<Node*>(first);
+				first = first->succ;
+				_destroy_node(node);
+			}
+			throw;
+		}
+		return evicted;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename KeyEqual>
+	bool lru_cache<Key, Value, Hash, KeyEqual>::contains(const Key& key) const
+	{
+		return index.contains(key);
+	}
+
+	template<typename Key, typename Value, typename Hash, typename KeyEqual>
+	size_t lru_cache<Key, Value, Hash, KeyEqual>::size() const noexcept
+	{
+		return index.size();
+	}
+
+	template<typename Key, typename Value, typename Hash, typename KeyEqual>
+	bool lru_cache<Key, Value, Hash, KeyEqual>::empty() const noexcept
+	{
+		return index.empty();
+	}
+
+	template<typename Key, typename Value, typename Hash, typename KeyEqual>
+	size_t lru_cache<Key, Value, Hash, KeyEqual>::capacity() const noexcept
+	{
+		return capacity_;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename KeyEqual>
+	void lru_cache<Key, Value, Hash, KeyEqual>::clear() noexcept
+	{
+		index.clear();
+		while (head.succ)
+		{
+			auto node = static_cast<Node*>(head.succ);
+			head.succ = node->succ;
+			_destroy_node(node);
+		}
+		tail = &head;
+	}
+
+	template<typename Key, typename Value, typename Hash, typename KeyEqual> template<typename Function>
+	void lru_cache<Key, Value, Hash, KeyEqual>::for_each(Function fn) const
+	{
+		for (auto link = head.succ; link; link = link->succ)
+		{
+			auto node = static_cast<const Node*>(link);
+			fn(node->key, node->value);
+		}
+	}
+};
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
@@ -0,0 +1,275 @@
+/*
+ * File: TVJ_Merged_View.h
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "TVJ_Forward_List.h"
+
+namespace tvj
+{
+	// The lazy view of the merged order of N lists sorted by Compare (e.g. tvj::forward_list sorted ASCENDING),
+	// the lists are neither modified nor copied.
+	// Its iterator keeps a heap of at most N cursors (const_iterator pairs) in a std::array,
+	// so nothing is allocated, and equal elements come in the order of the lists.
+	// Equal elements can be suppressed by unique(). The iterators are valid as long as the view and the lists.
+	template<typename List, size_t N, typename Compare>
+	class merged_range
+	{
+	public:
+		typedef typename List::const_iterator list_iterator;
+		typedef typename std::decay<decltype(*std::declval<const List&>().cbegin())>::type value_type;
+
+	protected:
+		// the position in a list and its end
+		struct Cursor
+		{
+			list_iterator pos;
+			list_iterator last;
+			size_t        list; // the index of the list, to order equal elements
+		};
+
+	private:
+		std::array<Cursor, N> cursors;
+		Compare comp;
+		bool    unique_ = false;
+
+	public:
+		class const_iterator
+		{
+			friend class merged_range<List, N, Compare>;
+
+		protected:
+			std::array<Cursor, N> heap; // only the first count cursors (not at their ends) are used
+			size_t         count;
+			const Compare* comp;
+			bool           unique;
+
+			const_iterator(const std::array<Cursor, N>& cursors, const Compare* comp_, bool unique_) noexcept;
+
+			// whether cursor a goes after cursor b
+			inline bool _after(const Cursor& a, const Cursor& b) const;
+
+			// move the cursor at the index down to its place
+			void _sift_down(size_t i);
+
+			// advance the top cursor and restore the heap
+			void _advance();
+
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef typename merged_range::value_type value_type;
+			typedef std::ptrdiff_t            difference_type;
+			typedef const value_type*         pointer;
+			typedef const value_type&         reference;
+
+			inline const value_type& operator*() const;
+			inline const value_type* operator->() const;
+			const_iterator& operator++();
+			inline const_iterator operator++(int);
+			inline bool operator==(const const_iterator& iter) const noexcept;
+			inline bool operator!=(const const_iterator& iter) const noexcept;
+		};
+
+		/**
+		 * brief: constructor
+		 * param: the comparison, the lists
+		 * return: --
+		 */
+		template<typename... Lists>
+		explicit merged_range(const Compare& comp_, const Lists&... lists);
+
+		/**
+		 * brief: the same view with equal elements suppressed (only the first is kept)
+		 * param: (void)
+		 * return: merged_range
+		 */
+		inline merged_range unique() const;
+
+		/**
+		 * brief: the iterator to the least element, the heap is built in O(N)
+		 * param: (void)
+		 * return: const_iterator
+		 */
+		const_iterator begin() const;
+
+		/**
+		 * brief: the end iterator
+		 * param: (void)
+		 * return: const_iterator
+		 */
+		inline const_iterator end() const noexcept;
+	};
+
+	/**
+	 * brief: the lazy view of the ascending merged order of the lists sorted ascending
+	 * param: the lists (of the same type)
+	 * return: merged_range
+	 */
+	template<typename List, typename... Lists>
+	inline merged_range<List, 1 + sizeof...(Lists), std::less<>> merged_view(const List& list, const Lists&... lists);
+
+	/**
+	 * brief: the lazy view of the merged order of the lists sorted by the comparison
+	 * param: the comparison, the lists (of the same type)
+	 * return: merged_range
+	 */
+	template<typename Compare, typename List, typename... Lists>
+	inline merged_range<List, 1 + sizeof...(Lists), Compare> merged_view_by(const Compare& comp, const List& list, const Lists&... lists);
+
+	template<typename List, size_t N, typename Compare>
+	merged_range<List, N, Compare>::const_iterator::const_iterator(const std::array<Cursor, N>& cursors, const Compare* comp_, bool unique_) noexcept
+		: heap(cursors), count(0), comp(comp_), unique(unique_) { }
+
+	template<typename List, size_t N, typename Compare>
+	bool merged_range<List, N, Compare>::const_iterator::_after(const Cursor& a, const Cursor& b) const
+	{
+		if ((*comp)(*b.pos, *a.pos)) return true;
+		if ((*comp)(*a.pos, *b.pos)) return false;
+		return b.list < a.list;
+	}
+
+	template<typename List, size_t N, typename Compare>
+	void merged_range<List, N, Compare>::const_iterator::_sift_down(size_t i)
+	{
+		while (true)
+		{
+			size_t next = 2 * i + 1;
+			if (next >= count) break;
+			if (next + 1 < count && _after(heap[next], heap[next + 1])) next++;
+			if (!_after(heap[i], heap[next])) break;
+			std::swap(heap[i], heap[next]);
+			i = next;
+		}
+	}
+
+	template<typename List, size_t N, typename Compare>
+	void merged_range<List, N, Compare>::const_iterator::_advance()
+	{
+		if (++heap[0].pos == heap[0].last)
+		{
+			if (--count == 0) return;
+			heap[0] = heap[count];
+		}
+		_sift_down(0);
+	}
+
+	template<typename List, size_t N, typename Compare>
+	const typename merged_range<List, N, Compare>::value_type& merged_range<List, N, Compare>::const_iterator::operator*() const
+	{
+#ifndef NDEBUG
+		if (!count) error_info("Dereference of end() of tvj::merged_range.", TVJ_FORWARD_LIST_NULLPTR);
+#endif
+		return *heap[0].pos;
+	}
+
+	template<typename List, size_t N, typename Compare>
+	const typename merged_range<List, N, Compare>::value_type* merged_range<List, N, Compare>::const_iterator::operator->() const
+	{
+		return &**this;
+	}
+
+	template<typename List, size_t N, typename Compare>
+	typename merged_range<List, N, Compare>::const_iterator& merged_range<List, N, Compare>::const_iterator::operator++()
+	{
+#ifndef NDEBUG
+		if (!count) error_info("Increment of end() of tvj::merged_range.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		if (!unique)
+		{
+			_advance();
+			return *this;
+		}
+		// the element stays in its list, so it can be compared after the cursor moves on
+		const value_type* prev = &*heap[0].pos;
+		do _advance();
+		while (count && !(*comp)(*prev, *heap[0].pos));
+		return *this;
+	}
+
+	template<typename List, size_t N, typename Compare>
+	typename merged_range<List, N, Compare>::const_iterator merged_range<List, N, Compare>::const_iterator::operator++(int)
+	{
+		auto ret = *this;
+		++*this;
+		return ret;
+	}
+
+	template<typename List, size_t N, typename Compare>
+	bool merged_range<List, N, Compare>::const_iterator::operator==(const const_iterator& iter) const noexcept
+	{
+		if (!count || !iter.count) return count == iter.count;
+		return heap[0].list == iter.heap[0].list && heap[0].pos == iter.heap[0].pos;
+	}
+
+	template<typename List, size_t N, typename Compare>
+	bool merged_range<List, N, Compare>::const_iterator::operator!=(const const_iterator& iter) const noexcept
+	{
+		return !(*this == iter);
+	}
+
+	template<typename List, size_t N, typename Compare> template<typename... Lists>
+	merged_range<List, N, Compare>::merged_range(const Compare& comp_, const Lists&... lists)
+		: cursors{ { Cursor{ lists.cbegin(), lists.cend(), 0 }... } }, comp(comp_)
+	{
+		static_assert(sizeof...(Lists) == N, "Wrong number of lists of tvj::merged_range.");
+		for (size_t i = 0; i != N; i++) cursors[i].list = i;
+	}
+
+	template<typename List, size_t N, typename Compare>
+	merged_range<List, N, Compare> merged_range<List, N, Compare>::unique() const
+	{
+		auto range = *this;
+		range.unique_ = true;
+		return range;
+	}
+
+	template<typename List, size_t N, typename Compare>
+	typename merged_range<List, N, Compare>::const_iterator merged_range<List, N, Compare>::begin() const
+	{
+		const_iterator iter(cursors, &comp, unique_);
+		for (auto& cursor : cursors)
+		{
+			if (cursor.pos != cursor.last) iter.heap[iter.count++] = cursor;
+		}
+		// heapify from the last parent up
+		for (size_t i = iter.count / 2; i-- != 0; ) iter._sift_down(i);
+		return iter;
+	}
+
+	template<typename List, size_t N, typename Compare>
+	typename merged_range<List, N, Compare>::const_iterator merged_range<List, N, Compare>::end() const noexcept
+	{
+		return const_iterator(cursors, &comp, unique_);
+	}
+
+	template<typename List, typename... Lists>
+	merged_range<List, 1 + sizeof...(Lists), std::less<>> merged_view(const List& list, const Lists&... lists)
+	{
+		return merged_range<List, 1 + sizeof...(Lists), std::less<>>(std::less<>(), list, lists...);
+	}
+
+	template<typename Compare, typename List, typename... Lists>
+	merged_range<List, 1 + sizeof...(Lists), Compare> merged_view_by(const Compare& comp, const List& list, const Lists&... lists)
+	{
+		return merged_range<List, 1 + sizeof...(Lists), Compare>(comp, list, lists...);
+	}
+};
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
@@ -0,0 +1,410 @@
+/*
+ * File: TVJ_Node_Pool.h
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <vector>
+#include "TVJ_Forward_List.h"
+
+namespace tvj
+{
+	// The free list of fixed-size blocks shared by the block pools (the first allocation fixes the block size).
+	// Blocks are carved on demand from the last region and recycled through the free list,
+	// a pool derived from it only decides how a region is reserved (Derived::_grow calls _carve_from).
+	template<typename Derived>
+	class block_free_list
+	{
+	protected:
+		// a free block, connected by succ
+		struct Block
+		{
+			Block* succ;
+		};
+
+		Block*         free_blocks = nullptr;
+		size_t         free_count  = 0;
+		unsigned char* cursor      = nullptr; // the next uncarved byte of the last region
+		unsigned char* limit       = nullptr; // the end of the last region
+		size_t         block_size_ = 0;       // set by the first allocation
+		size_t         stride      = 0;       // the block size padded for the free list and alignment
+
+		block_free_list() = default;
+		block_free_list(const block_free_list&) = delete;
+		block_free_list& operator=(const block_free_list&) = delete;
+
+		// carve the following blocks from a new region
+		inline void _carve_from(void* region, size_t bytes) noexcept;
+
+		// the number of blocks not carved yet from the last region
+		inline size_t _uncarved() const noexcept;
+
+	public:
+		/**
+		 * brief: take a block (the first call fixes the block size)
+		 * param: the block size and alignment in bytes
+		 * return: void*
+		 */
+		void* allocate(size_t bytes, size_t alignment);
+
+		/**
+		 * brief: return a block
+		 * param: the block
+		 * return: void
+		 */
+		inline void deallocate(void* ptr) noexcept;
+
+		/**
+		 * brief: the block size (0 before the first allocation)
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t block_size() const noexcept;
+	};
+
+	// The allocator binding containers to a block pool (e.g. tvj::fixed_block_pool),
+	// objects of another size than the pool blocks go to ::operator new.
+	template<typename T, typename Pool>
+	class block_allocator
+	{
+		template<typename U, typename P> friend class block_allocator;
+
+	private:
+		Pool* pool;
+
+	public:
+		typedef T value_type;
+
+		template<typename U>
+		struct rebind
+		{
+			typedef block_allocator<U, Pool> other;
+		};
+
+		/**
+		 * brief: constructor
+		 * param: the pool
+		 * return: --
+		 */
+		block_allocator(Pool& pool_) noexcept;
+
+		/**
+		 * brief: constructor from the allocator of another type
+		 * param: another block_allocator of the same pool type
+		 * return: --
+		 */
+		template<typename U>
+		block_allocator(const block_allocator<U, Pool>& alloc) noexcept;
+
+		/**
+		 * brief: allocate n objects
+		 * param: the number of objects
+		 * return: T*
+		 */
+		inline T* allocate(size_t n);
+
+		/**
+		 * brief: deallocate n objects
+		 * param: the pointer, the number of objects
+		 * return: void
+		 */
+		inline void deallocate(T* ptr, size_t n) noexcept;
+
+		/**
+		 * brief: the pool bound to
+		 * param: (void)
+		 * return: Pool*
+		 */
+		inline Pool* resource() const noexcept;
+
+		template<typename U>
+		inline bool operator==(const block_allocator<U, Pool>& alloc) const noexcept;
+		template<typename U>
+		inline bool operator!=(const block_allocator<U, Pool>& alloc) const noexcept;
+	};
+
+	// The pool of fixed-size blocks (the node size) shared by many containers,
+	// blocks are carved from chunks reserved by ::operator new.
+	class fixed_block_pool : public block_free_list<fixed_block_pool>
+	{
+		friend class block_free_list<fixed_block_pool>;
+
+	public:
+		// the statistics of the whole pool
+		struct Stats
+		{
+			size_t chunks;   // the chunks reserved from the system
+			size_t blocks;   // all the blocks in the chunks
+			size_t in_use;   // the blocks taken by containers
+			size_t free;     // the blocks in the free list or not carved yet
+			size_t reserved; // the bytes reserved from the system
+		};
+
+	private:
+		std::vector<unsigned char*> chunks;
+		size_t chunk_blocks; // the number of blocks in a chunk
+
+		// reserve a new chunk and carve from it
+		void _grow();
+
+	public:
+		/**
+		 * brief: constructor
+		 * param: the number of blocks in a chunk
+		 * return: --
+		 */
+		explicit fixed_block_pool(size_t chunk_blocks_ = 1024);
+
+		/**
+		 * brief: destructor, all chunks are returned to the system
+		 * param: (void)
+		 * return: --
+		 */
+		~fixed_block_pool();
+
+		/**
+		 * brief: the statistics of the whole pool
+		 * param: (void)
+		 * return: Stats
+		 */
+		Stats stats() const noexcept;
+
+		/**
+		 * brief: return the chunks whose blocks are all free to the system,
+		 *        the free list is rebuilt in address order
+		 * param: (void)
+		 * return: size_t (the number of chunks released)
+		 */
+		size_t trim();
+	};
+
+	// the allocator binding containers to a tvj::fixed_block_pool
+	template<typename T>
+	using pool_allocator = block_allocator<T, fixed_block_pool>;
+
+	// tvj::forward_list whose nodes come from a tvj::fixed_block_pool
+	template<typename Elem>
+	using pooled_forward_list = forward_list<Elem, pool_allocator<Elem>>;
+
+	// The node pool shared by many tvj::pooled_forward_list<Elem>
+	// (e.g. tvj::pooled_forward_list<int> list(pool)),
+	// nodes moved by splice_after between these lists stay in the pool.
+	template<typename Elem>
+	class forward_list_pool : public fixed_block_pool
+	{
+	public:
+		typedef pooled_forward_list<Elem> list_type;
+
+		/**
+		 * brief: constructor
+		 * param: the number of nodes in a chunk
+		 * return: --
+		 */
+		explicit forward_list_pool(size_t chunk_nodes = 1024);
+
+		/**
+		 * brief: the allocator of lists sharing this pool
+		 * param: (void)
+		 * return: pool_allocator<Elem>
+		 */
+		inline pool_allocator<Elem> allocator() noexcept;
+	};
+
+	template<typename Derived>
+	void block_free_list<Derived>::_carve_from(void* region, size_t bytes) noexcept
+	{
+		cursor = static_cast<unsigned char*>(region);
+		limit  = cursor + bytes;
+	}
+
+	template<typename Derived>
+	size_t block_free_list<Derived>::_uncarved() const noexcept
+	{
+		return stride ? static_cast<size_t>(limit - cursor) / stride : 0;
+	}
+
+	template<typename Derived>
+	void* block_free_list<Derived>::allocate(size_t bytes, size_t alignment)
+	{
+		if (!block_size_)
+		{
+			const size_t size = bytes < sizeof(Block) ? sizeof(Block) : bytes;
+			const size_t align = alignment < alignof(Block) ? alignof(Block) : alignment;
+			block_size_ = bytes;
+			stride = (size + align - 1) / align * align;
+		}
+#ifndef NDEBUG
+		if (bytes > block_size_)
+			error_info("Allocation larger than the block size of a tvj block pool.", TVJ_FORWARD_LIST_OVERFLOW);
+		if (alignment > alignof(std::max_align_t))
+			error_info("Over-aligned allocation from a tvj block pool.", TVJ_FORWARD_LIST_TYPE_MISMATCH);
+#endif
+		if (free_blocks)
+		{
+			auto block = free_blocks;
+			free_blocks = block->succ;
+			free_count--;
+			return block;
+		}
+		if (static_cast<size_t>(limit - cursor) < stride) static_cast<Derived*>(this)->_grow();
+		auto block = cursor;
+		cursor += stride;
+		return block;
+	}
+
+	template<typename Derived>
+	void block_free_list<Derived>::deallocate(void* ptr) noexcept
+	{
+		auto block = static_cast<Block*>(ptr);
+		block->succ = free_blocks;
+		free_blocks = block;
+		free_count++;
+	}
+
+	template<typename Derived>
+	size_t block_free_list<Derived>::block_size() const noexcept
+	{
+		return block_size_;
+	}
+
+	template<typename T, typename Pool>
+	block_allocator<T, Pool>::block_allocator(Pool& pool_) noexcept : pool(&pool_) { }
+
+	template<typename T, typename Pool> template<typename U>
+	block_allocator<T, Pool>::block_allocator(const block_allocator<U, Pool>& alloc) noexcept : pool(alloc.pool) { }
+
+	template<typename T, typename Pool>
+	T* block_allocator<T, Pool>::allocate(size_t n)
+	{
+		if (n == 1 && (!pool->block_size() || sizeof(T) == pool->block_size()))
+			return static_cast<T*>(pool->allocate(sizeof(T), alignof(T)));
+		return static_cast<T*>(::operator new(n * sizeof(T)));
+	}
+
+	template<typename T, typename Pool>
+	void block_allocator<T, Pool>::deallocate(T* ptr, size_t n) noexcept
+	{
+		if (n == 1 && sizeof(T) == pool->block_size()) pool->deallocate(ptr);
+		else                                           ::operator delete(ptr);
+	}
+
+	template<typename T, typename Pool>
+	Pool* block_allocator<T, Pool>::resource() const noexcept
+	{
+		return pool;
+	}
+
+	template<typename T, typename Pool> template<typename U>
+	bool block_allocator<T, Pool>::operator==(const block_allocator<U, Pool>& alloc) const noexcept
+	{
+		return pool == alloc.pool;
+	}
+
+	template<typename T, typename Pool> template<typename U>
+	bool block_allocator<T, Pool>::operator!=(const block_allocator<U, Pool>& alloc) const noexcept
+	{
+		return pool != alloc.pool;
+	}
+
+	inline void fixed_block_pool::_grow()
+	{
+		auto chunk = static_cast<unsigned char*>(::operator new(chunk_blocks * stride));
+		chunks.push_back(chunk);
+		_carve_from(chunk, chunk_blocks * stride);
+	}
+
+	inline fixed_block_pool::fixed_block_pool(size_t chunk_blocks_) : chunk_blocks(chunk_blocks_ ? chunk_blocks_ : 1) { }
+
+	inline fixed_block_pool::~fixed_block_pool()
+	{
+		for (auto chunk : chunks) ::operator delete(chunk);
+	}
+
+	inline fixed_block_pool::Stats fixed_block_pool::stats() const noexcept
+	{
+		const size_t blocks = chunks.size() * chunk_blocks;
+		const size_t free = free_count + _uncarved();
+		return Stats{ chunks.size(), blocks, blocks - free, free, blocks * stride };
+	}
+
+	inline size_t fixed_block_pool::trim()
+	{
+		const size_t uncarved = _uncarved();
+		if (!free_count && !uncarved) return 0;
+
+		// count the free blocks of each chunk (ordered by address)
+		const size_t chunk_bytes = chunk_blocks * stride;
+		std::sort(chunks.begin(), chunks.end(), std::less<unsigned char*>());
+		std::vector<unsigned char*> blocks;
+		blocks.reserve(free_count);
+		for (auto block = free_blocks; block; block = block->succ) blocks.push_back(reinterpret_cast<unsigned char*>(block));
+		std::sort(blocks.begin(), blocks.end(), std::less<unsigned char*>());
+		std::vector<size_t> counts(chunks.size(), 0);
+		for (auto block : blocks)
+		{
+			const auto chunk = std::upper_bound(chunks.begin(), chunks.end(), block, std::less<unsigned char*>()) - 1;
+			counts[chunk - chunks.begin()]++;
+		}
+		// the blocks not carved yet from the last chunk are free as well
+		if (uncarved)
+		{
+			const auto chunk = std::upper_bound(chunks.begin(), chunks.end(), cursor, std::less<unsigned char*>()) - 1;
+			counts[chunk - chunks.begin()] += uncarved;
+		}
+
+		// release the chunks with all blocks free and keep the others
+		size_t kept = 0, released = 0;
+		for (size_t i = 0; i != chunks.size(); i++)
+		{
+			if (counts[i] == chunk_blocks)
+			{
+				if (cursor >= chunks[i] && cursor < chunks[i] + chunk_bytes) cursor = limit = nullptr;
+				::operator delete(chunks[i]);
+				released++;
+			}
+			else chunks[kept++] = chunks[i];
+		}
+		if (!released) return 0;
+		chunks.resize(kept);
+
+		// rebuild the free list from the blocks of the kept chunks, the lowest address first
+		free_blocks = nullptr;
+		free_count = 0;
+		size_t j = chunks.size();
+		for (auto i = blocks.rbegin(); i != blocks.rend(); ++i)
+		{
+			while (j && *i < chunks[j - 1]) j--;
+			if (!j || *i >= chunks[j - 1] + chunk_bytes) continue; // in a released chunk
+			auto block = reinterpret_cast<Block*>(*i);
+			block->succ = free_blocks;
+			free_blocks = block;
+			free_count++;
+		}
+		return released;
+	}
+
+	template<typename Elem>
+	forward_list_pool<Elem>::forward_list_pool(size_t chunk_nodes) : fixed_block_pool(chunk_nodes) { }
+
+	template<typename Elem>
+	pool_allocator<Elem> forward_list_pool<Elem>::allocator() noexcept
+	{
+		return pool_allocator<Elem>(*this);
+	}
+};
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
@@ -0,0 +1,579 @@
+/*
+ * File: TVJ_Pairing_Heap.h
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "TVJ_Forward_List.h"
+
+namespace tvj
+{
+	// The tvj::pairing_heap class (a min heap by Compare, std::greater makes a max heap)
+	// whose nodes are linked as a tree by the first child and the next sibling,
+	// the children of a node form a singly linked list with a back link for cutting in O(1).
+	// push, meld and decrease_key are O(1), pop is O(log n) amortized.
+	// Compare is always called before any link is changed, so the heap stays valid if it throws.
+	template<typename Elem, typename Compare = std::less<Elem>, typename Alloc = std::allocator<Elem>>
+	class pairing_heap
+	{
+	protected:
+		// the class of the heap node
+		struct Node
+		{
+			template<typename... Args>
+			Node(Args&&... args);
+			Node* child   = nullptr; // the first child
+			Node* sibling = nullptr; // the next sibling
+			Node* prev    = nullptr; // the previous sibling, or the parent of the first child
+			Elem  data;              // the data the node contains
+		};
+
+	public:
+		typedef Alloc allocator_type;
+
+	protected:
+		typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node> node_allocator;
+		typedef std::allocator_traits<node_allocator> node_traits;
+
+		// the root (the least element) stored next to the allocator, which takes no space if stateless
+		struct Head : node_allocator
+		{
+			Head(const node_allocator& alloc);
+			Node* root = nullptr;
+		};
+
+		// allocate and construct a node with the allocator
+		template<typename... Args>
+		Node* _create_node(Args&&... args);
+
+		// destroy and deallocate a node with the allocator
+		void _destroy_node(Node* node) noexcept;
+
+		// make loser the first child of winner, return winner
+		static inline Node* _attach(Node* winner, Node* loser) noexcept;
+
+		// link two roots, the loser becomes the first child of the winner, return the winner
+		inline Node* _link(Node* a, Node* b) const;
+
+		// combine the children of parent into one tree by the two-pass pairing and return its root,
+		// if Compare throws the partly combined trees are left as the children of parent
+		Node* _combine(Node* parent) const;
+
+		// cut the subtree of a node which is not the root
+		static inline void _cut(Node* node) noexcept;
+
+	private:
+		Head    head;
+		Compare comp;
+		size_t  size_ = 0;
+
+	public:
+		// The handle of an element pushed, it stays valid until the element is popped or erased.
+		class handle
+		{
+			friend class pairing_heap<Elem, Compare, Alloc>;
+
+		protected:
+			Node* node = nullptr;
+
+			handle(Node* node_) noexcept;
+
+		public:
+			handle() = default;
+
+			inline const Elem& operator*() const;
+			inline const Elem* operator->() const;
+		};
+
+		/**
+		 * brief: constructor for empty heap
+		 * param: the comparison, the allocator
+		 * return: --
+		 */
+		explicit pairing_heap(const Compare& comp_ = Compare(), const Alloc& alloc = Alloc());
+
+		pairing_heap(const pairing_heap&) = delete;
+		pairing_heap& operator=(const pairing_heap&) = delete;
+
+		/**
+		 * brief: move constructor (the handles stay valid)
+		 * param: another heap
+		 * return: --
+		 */
+		pairing_heap(pairing_heap&& heap) noexcept;
+
+		/**
+		 * brief: move assignment, the handles stay valid if the allocators are equal,
+		 *        otherwise the elements are moved one by one
+		 * param: another heap
+		 * return: pairing_heap&
+		 */
+		pairing_heap& operator=(pairing_heap&& heap);
+
+		/**
+		 * @brief: destructor
+		 * @param: (void)
+		 * @return: --
+		 */
+		~pairing_heap();
+
+		/**
+		 * brief: the allocator of the heap
+		 * param: (void)
+		 * return: allocator_type
+		 */
+		inline allocator_type get_allocator() const;
+
+		/**
+		 * brief: push an element in O(1)
+		 * param: the element
+		 * return: handle
+		 */
+		inline handle push(const Elem& elem);
+
+		/**
+		 * brief: push an element in O(1)
+		 * param: the element (rvalue)
+		 * return: handle
+		 */
+		inline handle push(Elem&& elem);
+
+		/**
+		 * brief: construct an element in place in O(1)
+		 * param: the arguments of the element constructor
+		 * return: handle
+		 */
+		template<typename... Args>
+		handle emplace(Args&&... args);
+
+		/**
+		 * brief: the least element
+		 * param: (void)
+		 * return: const Elem&
+		 */
+		inline const Elem& top() const;
+
+		/**
+		 * brief: remove the least element in O(log n) amortized
+		 * param: (void)
+		 * return: void
+		 */
+		void pop();
+
+		/**
+		 * brief: replace an element by one not larger in O(1)
+		 * param: the handle, the new element
+		 * return: void
+		 */
+		void decrease_key(const handle& pos, const Elem& elem);
+
+		/**
+		 * brief: replace an element by one not larger in O(1)
+		 * param: the handle, the new element (rvalue)
+		 * return: void
+		 */
+		void decrease_key(const handle& pos, Elem&& elem);
+
+		/**
+		 * brief: remove an element in O(log n) amortized
+		 * param: the handle
+		 * return: void
+		 */
+		void erase(const handle& pos);
+
+		/**
+		 * brief: move all elements of another heap into this one in O(1),
+		 *        the allocators must be equal and the handles stay valid
+		 * param: another heap
+		 * return: void
+		 */
+		void meld(pairing_heap& heap);
+
+		/**
+		 * brief: remove all elements
+		 * param: (void)
+		 * return: void
+		 */
+		void clear() noexcept;
+
+		/**
+		 * brief: the number of elements
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t size() const noexcept;
+
+		/**
+		 * brief: if the heap is empty
+		 * param: (void)
+		 * return: bool
+		 */
+		inline bool empty() const noexcept;
+	};
+
+	template<typename Elem, typename Compare, typename Alloc> template<typename... Args>
+	pairing_heap<Elem, Compare, Alloc>::Node::Node(Args&&... args) : data(std::forward<Args>(args)...) { }
+
+	template<typename Elem, typename Compare, typename Alloc>
+	pairing_heap<Elem, Compare, Alloc>::Head::Head(const node_allocator& alloc) : node_allocator(alloc) { }
+
+	template<typename Elem, typename Compare, typename Alloc> template<typename... Args>
+	typename pairing_heap<Elem, Compare, Alloc>::Node* pairing_heap<Elem, Compare, Alloc>::_create_node(Args&&... args)
+	{
+		node_allocator& alloc = head;
+		Node* node = node_traits::allocate(alloc, 1);
+		try
+		{
+			node_traits::construct(alloc, node, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			node_traits::deallocate(alloc, node, 1);
+			throw;
+		}
+		return node;
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	void pairing_heap<Elem, Compare, Alloc>::_destroy_node(Node* node) noexcept
+	{
+		node_allocator& alloc = head;
+		node_traits::destroy(alloc, node);
+		node_traits::deallocate(alloc, node, 1);
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	typename pairing_heap<Elem, Compare, Alloc>::Node* pairing_heap<Elem, Compare, Alloc>::_attach(Node* winner, Node* loser) noexcept
+	{
+		loser->prev = winner;
+		loser->sibling = winner->child;
+		if (winner->child) winner->child->prev = loser;
+		winner->child = loser;
+		return winner;
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	typename pairing_heap<Elem, Compare, Alloc>::Node* pairing_heap<Elem, Compare, Alloc>::_link(Node* a, Node* b) const
+	{
+		return comp(b->data, a->data) ? _attach(b, a) : _attach(a, b);
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	typename pairing_heap<Elem, Compare, Alloc>::Node* pairing_heap<Elem, Compare, Alloc>::_combine(Node* parent) const
+	{
+		Node* first = parent->child;
+		if (!first) return nullptr;
+		Node* pairs = nullptr; // the trees linked in the first pass, by sibling from right to left
+		Node* root = nullptr;  // the tree of the second pass
+		try
+		{
+			// the first pass links the siblings in pairs from left to right
+			while (first)
+			{
+				Node* a = first;
+				Node* b = a->sibling;
+				if (!b)
+				{
+					first = nullptr;
+					a->sibling = pairs;
+					pairs = a;
+					break;
+				}
+				const bool b_wins = comp(b->data, a->data);
+				first = b->sibling;
+				a->sibling = b->sibling = nullptr;
+				auto winner = b_wins ? _attach(b, a) : _attach(a, b);
+				winner->sibling = pairs;
+				pairs = winner;
+			}
+			// the second pass links them from right to left
+			root = pairs;
+			pairs = pairs->sibling;
+			root->sibling = nullptr;
+			while (pairs)
+			{
+				const bool pairs_wins = comp(pairs->data, root->data);
+				auto next = pairs->sibling;
+				pairs->sibling = nullptr;
+				root = pairs_wins ? _attach(pairs, root) : _attach(root, pairs);
+				pairs = next;
+			}
+		}
+		catch (...)
+		{
+			// every piece is a heap ordered tree of former descendants, so they become the children again
+			Node** link = &parent->child;
+			Node* prev = parent;
+			for (auto chain : { root, pairs, first })
+			{
+				for (auto node = chain; node; node = node->sibling)
+				{
+					*link = node;
+					node->prev = prev;
+					prev = node;
+					link = &node->sibling;
+				}
+			}
+			*link = nullptr;
+			throw;
+		}
+		parent->child = nullptr;
+		root->prev = nullptr;
+		return root;
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	void pairing_heap<Elem, Compare, Alloc>::_cut(Node* node) noexcept
+	{
+		if (node->prev->child == node) node->prev->child = node->sibling;
+		else                           node->prev->sibling = node->sibling;
+		if (node->sibling) node->sibling->prev = node->prev;
+		node->sibling = node->prev = nullptr;
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	pairing_heap<Elem, Compare, Alloc>::handle::handle(Node* node_) noexcept : node(node_) { }
+
+	template<typename Elem, typename Compare, typename Alloc>
+	const Elem& pairing_heap<Elem, Compare, Alloc>::handle::operator*() const
+	{
+#ifndef NDEBUG
+		if (!node) error_info("Dereference of an empty handle of tvj::pairing_heap.", TVJ_FORWARD_LIST_NULLPTR);
+#endif
+		return node->data;
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	const Elem* pairing_heap<Elem, Compare, Alloc>::handle::operator->() const
+	{
+		return &**this;
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	pairing_heap<Elem, Compare, Alloc>::pairing_heap(const Compare& comp_, const Alloc& alloc) : head(node_allocator(alloc)), comp(comp_) { }
+
+	template<typename Elem, typename Compare, typename Alloc>
+	pairing_heap<Elem, Compare, Alloc>::pairing_heap(pairing_heap&& heap) noexcept
+		: head(std::move(static_cast<node_allocator&>(heap.head))), comp(heap.comp), size_(heap.size_)
+	{
+		head.root = heap.head.root;
+		heap.head.root = nullptr;
+		heap.size_ = 0;
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	pairing_heap<Elem, Compare, Alloc>& pairing_heap<Elem, Compare, Alloc>::operator=(pairing_heap&& heap)
+	{
+		if (&heap == this) return *this;
+		clear();
+		comp = heap.comp;
+		if (static_cast<node_allocator&>(head) == static_cast<node_allocator&>(heap.head))
+		{
+			head.root = heap.head.root;
+			size_ = heap.size_;
+			heap.head.root = nullptr;
+			heap.size_ = 0;
+			return *this;
+		}
+		// the nodes cannot be freed by this allocator
+		std::vector<Node*> rest;
+		if (heap.head.root) rest.push_back(heap.head.root);
+		while (!rest.empty())
+		{
+			auto node = rest.back();
+			rest.pop_back();
+			for (auto child = node->child; child; child = child->sibling) rest.push_back(child);
+			emplace(std::move(node->data));
+		}
+		heap.clear();
+		return *this;
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	pairing_heap<Elem, Compare, Alloc>::~pairing_heap()
+	{
+		clear();
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	typename pairing_heap<Elem, Compare, Alloc>::allocator_type pairing_heap<Elem, Compare, Alloc>::get_allocator() const
+	{
+		return allocator_type(static_cast<const node_allocator&>(head));
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	typename pairing_heap<Elem, Compare, Alloc>::handle pairing_heap<Elem, Compare, Alloc>::push(const Elem& elem)
+	{
+		return emplace(elem);
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	typename pairing_heap<Elem, Compare, Alloc>::handle pairing_heap<Elem, Compare, Alloc>::push(Elem&& elem)
+	{
+		return emplace(std::move(elem));
+	}
+
+	template<typename Elem, typename Compare, typename Alloc> template<typename... Args>
+	typename pairing_heap<Elem, Compare, Alloc>::handle pairing_heap<Elem, Compare, Alloc>::emplace(Args&&... args)
+	{
+		auto node = _create_node(std::forward<Args>(args)...);
+		try
+		{
+			head.root = head.root ? _link(head.root, node) : node;
+		}
+		catch (...)
+		{
+			_destroy_node(node);
+			throw;
+		}
+		size_++;
+		return handle(node);
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	const Elem& pairing_heap<Elem, Compare, Alloc>::top() const
+	{
+#ifndef NDEBUG
+		if (!head.root) error_info("Top of an empty tvj::pairing_heap.", TVJ_FORWARD_LIST_UNDERFLOW);
+#endif
+		return head.root->data;
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	void pairing_heap<Elem, Compare, Alloc>::pop()
+	{
+#ifndef NDEBUG
+		if (!head.root) error_info("Pop from an empty tvj::pairing_heap.", TVJ_FORWARD_LIST_UNDERFLOW);
+#endif
+		auto node = head.root;
+		head.root = _combine(node);
+		_destroy_node(node);
+		size_--;
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	void pairing_heap<Elem, Compare, Alloc>::decrease_key(const handle& pos, const Elem& elem)
+	{
+		decrease_key(pos, Elem(elem));
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	void pairing_heap<Elem, Compare, Alloc>::decrease_key(const handle& pos, Elem&& elem)
+	{
+		auto node = pos.node;
+#ifndef NDEBUG
+		if (!node) error_info("Decrease key of an empty handle of tvj::pairing_heap.", TVJ_FORWARD_LIST_NULLPTR);
+		if (comp(node->data, elem)) error_info("Increase key in decrease_key of tvj::pairing_heap.", TVJ_FORWARD_LIST_TYPE_MISMATCH);
+#endif
+		if (node == head.root)
+		{
+			node->data = std::move(elem);
+			return;
+		}
+		// compare before anything is changed
+		const bool node_wins = comp(elem, head.root->data);
+		node->data = std::move(elem);
+		_cut(node);
+		head.root = node_wins ? _attach(node, head.root) : _attach(head.root, node);
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	void pairing_heap<Elem, Compare, Alloc>::erase(const handle& pos)
+	{
+		auto node = pos.node;
+#ifndef NDEBUG
+		if (!node) error_info("Erase of an empty handle of tvj::pairing_heap.", TVJ_FORWARD_LIST_NULLPTR);
+#endif
+		if (node == head.root)
+		{
+			pop();
+			return;
+		}
+		auto sub = _combine(node);
+		bool sub_wins = false;
+		if (sub)
+		{
+			try
+			{
+				sub_wins = comp(sub->data, head.root->data);
+			}
+			catch (...)
+			{
+				// the combined tree stays under node
+				node->child = sub;
+				sub->prev = node;
+				throw;
+			}
+		}
+		_cut(node);
+		if (sub) head.root = sub_wins ? _attach(sub, head.root) : _attach(head.root, sub);
+		_destroy_node(node);
+		size_--;
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	void pairing_heap<Elem, Compare, Alloc>::meld(pairing_heap& heap)
+	{
+		if (&heap == this || !heap.head.root) return;
+#ifndef NDEBUG
+		if (static_cast<node_allocator&>(head) != static_cast<node_allocator&>(heap.head))
+			error_info("Meld of tvj::pairing_heap with different allocators.", TVJ_FORWARD_LIST_TYPE_MISMATCH);
+#endif
+		head.root = head.root ? _link(head.root, heap.head.root) : heap.head.root;
+		size_ += heap.size_;
+		heap.head.root = nullptr;
+		heap.size_ = 0;
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	void pairing_heap<Elem, Compare, Alloc>::clear() noexcept
+	{
+		// the children of each node are put in front of the nodes left to destroy
+		Node* rest = head.root;
+		while (rest)
+		{
+			auto node = rest;
+			rest = node->sibling;
+			if (auto child = node->child)
+			{
+				auto last = child;
+				while (last->sibling) last = last->sibling;
+				last->sibling = rest;
+				rest = child;
+			}
+			_destroy_node(node);
+		}
+		head.root = nullptr;
+		size_ = 0;
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	size_t pairing_heap<Elem, Compare, Alloc>::size() const noexcept
+	{
+		return size_;
+	}
+
+	template<typename Elem, typename Compare, typename Alloc>
+	bool pairing_heap<Elem, Compare, Alloc>::empty() const noexcept
+	{
+		return !size_;
+	}
+};
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
@@ -0,0 +1,278 @@
+/*
+ * File: TVJ_SPSC_Queue.h
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "TVJ_Forward_List.h"
+
+namespace tvj
+{
+	// The unbounded FIFO queue between exactly one producer thread and one consumer thread.
+	// It is the chain of push_back and pop_front with a sentinel: the producer only moves tail
+	// and the consumer only moves head, the sentinel being the node of the last popped element.
+	// The nodes before head are taken back by the producer to push later elements,
+	// so once enough nodes are allocated both sides are wait-free and nothing is allocated.
+	template<typename Elem, typename Alloc = std::allocator<Elem>>
+	class spsc_queue
+	{
+	protected:
+		static constexpr size_t cache_line = 64;
+
+		// the class of the queue node, the element is constructed by push and destroyed by pop
+		struct Node
+		{
+			std::atomic<Node*> succ;
+			typename std::aligned_storage<sizeof(Elem), alignof(Elem)>::type storage;
+
+			Node() noexcept;
+			inline Elem* data() noexcept;
+		};
+
+	public:
+		typedef Alloc allocator_type;
+
+	protected:
+		typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node> node_allocator;
+		typedef std::allocator_traits<node_allocator> node_traits;
+
+		// the fields only the consumer writes
+		struct alignas(cache_line) Consumer
+		{
+			std::atomic<Node*> head; // the sentinel before the front
+		};
+
+		// the fields only the producer touches, and the allocator (empty base)
+		struct alignas(cache_line) Producer : node_allocator
+		{
+			Producer(const node_allocator& alloc);
+			Node* tail;      // the last node
+			Node* first;     // the first node not yet reused (the chain from it to head is consumed)
+			Node* head_copy; // the head seen last time by the producer
+		};
+
+		// allocate and construct an empty node with the allocator
+		Node* _create_node();
+
+		// take a consumed node or allocate a new one (producer)
+		Node* _acquire();
+
+	private:
+		Consumer consumer;
+		Producer producer;
+
+	public:
+		/**
+		 * brief: constructor
+		 * param: the allocator
+		 * return: --
+		 */
+		explicit spsc_queue(const Alloc& alloc = Alloc());
+
+		spsc_queue(const spsc_queue&) = delete;
+		spsc_queue& operator=(const spsc_queue&) = delete;
+
+		/**
+		 * @brief: destructor, no thread may use the queue any more
+		 * @param: (void)
+		 * @return: --
+		 */
+		~spsc_queue();
+
+		/**
+		 * brief: allocate nodes in advance (producer)
+		 * param: the number of nodes
+		 * return: void
+		 */
+		void reserve(size_t n);
+
+		/**
+		 * brief: push an element at the back (producer)
+		 * param: the element
+		 * return: void
+		 */
+		inline void push(const Elem& elem);
+
+		/**
+		 * brief: push an element at the back (producer)
+		 * param: the element (rvalue)
+		 * return: void
+		 */
+		inline void push(Elem&& elem);
+
+		/**
+		 * brief: construct an element at the back (producer)
+		 * param: the arguments of the element constructor
+		 * return: void
+		 */
+		template<typename... Args>
+		void emplace(Args&&... args);
+
+		/**
+		 * brief: pop the front element (consumer)
+		 * param: the element to move to
+		 * return: bool (false if the queue is empty)
+		 */
+		bool try_pop(Elem& elem);
+
+		/**
+		 * brief: pass the front element to the function and pop it (consumer)
+		 * param: the function called with Elem&
+		 * return: bool (false if the queue is empty)
+		 */
+		template<typename Function>
+		bool consume(Function fn);
+
+		/**
+		 * brief: if the queue is empty (exact for the consumer, a snapshot for others)
+		 * param: (void)
+		 * return: bool
+		 */
+		inline bool empty() const noexcept;
+	};
+
+	template<typename Elem, typename Alloc>
+	spsc_queue<Elem, Alloc>::Node::Node() noexcept : succ(nullptr) { }
+
+	template<typename Elem, typename Alloc>
+	Elem* spsc_queue<Elem, Alloc>::Node::data() noexcept
+	{
+		return reinterpret_cast<Elem*>(&storage);
+	}
+
+	template<typename Elem, typename Alloc>
+	spsc_queue<Elem, Alloc>::Producer::Producer(const node_allocator& alloc) : node_allocator(alloc) { }
+
+	template<typename Elem, typename Alloc>
+	typename spsc_queue<Elem, Alloc>::Node* spsc_queue<Elem, Alloc>::_create_node()
+	{
+		node_allocator& alloc = producer;
+		Node* node = node_traits::allocate(alloc, 1);
+		node_traits::construct(alloc, node);
+		return node;
+	}
+
+	template<typename Elem, typename Alloc>
+	typename spsc_queue<Elem, Alloc>::Node* spsc_queue<Elem, Alloc>::_acquire()
+	{
+		if (producer.first == producer.head_copy)
+		{
+			producer.head_copy = consumer.head.load(std::memory_order_acquire);
+			if (producer.first == producer.head_copy) return _create_node();
+		}
+		auto node = producer.first;
+		producer.first = node->succ.load(std::memory_order_relaxed);
+		node->succ.store(nullptr, std::memory_order_relaxed);
+		return node;
+	}
+
+	template<typename Elem, typename Alloc>
+	spsc_queue<Elem, Alloc>::spsc_queue(const Alloc& alloc) : producer(node_allocator(alloc))
+	{
+		auto sentinel = _create_node();
+		consumer.head.store(sentinel, std::memory_order_relaxed);
+		producer.tail = producer.first = producer.head_copy = sentinel;
+	}
+
+	template<typename Elem, typename Alloc>
+	spsc_queue<Elem, Alloc>::~spsc_queue()
+	{
+		node_allocator& alloc = producer;
+		auto head = consumer.head.load(std::memory_order_relaxed);
+		bool alive = false; // the nodes after head hold elements
+		for (auto node = producer.first; node; )
+		{
+			auto next = node->succ.load(std::memory_order_relaxed);
+			if (alive) node->data()->~Elem();
+			if (node == head) alive = true;
+			node_traits::destroy(alloc, node);
+			node_traits::deallocate(alloc, node, 1);
+			node = next;
+		}
+	}
+
+	template<typename Elem, typename Alloc>
+	void spsc_queue<Elem, Alloc>::reserve(size_t n)
+	{
+		// the spare nodes are put before first, where only the producer looks
+		for (; n; n--)
+		{
+			auto node = _create_node();
+			node->succ.store(producer.first, std::memory_order_relaxed);
+			producer.first = node;
+		}
+	}
+
+	template<typename Elem, typename Alloc>
+	void spsc_queue<Elem, Alloc>::push(const Elem& elem)
+	{
+		emplace(elem);
+	}
+
+	template<typename Elem, typename Alloc>
+	void spsc_queue<Elem, Alloc>::push(Elem&& elem)
+	{
+		emplace(std::move(elem));
+	}
+
+	template<typename Elem, typename Alloc> template<typename... Args>
+	void spsc_queue<Elem, Alloc>::emplace(Args&&... args)
+	{
+		auto node = _acquire();
+		try
+		{
+			::new (static_cast<void*>(node->data())) Elem(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			node->succ.store(producer.first, std::memory_order_relaxed);
+			producer.first = node;
+			throw;
+		}
+		producer.tail->succ.store(node, std::memory_order_release);
+		producer.tail = node;
+	}
+
+	template<typename Elem, typename Alloc>
+	bool spsc_queue<Elem, Alloc>::try_pop(Elem& elem)
+	{
+		return consume([&elem](Elem& front) { elem = std::move(front); });
+	}
+
+	template<typename Elem, typename Alloc> template<typename Function>
+	bool spsc_queue<Elem, Alloc>::consume(Function fn)
+	{
+		auto head = consumer.head.load(std::memory_order_relaxed);
+		auto node = head->succ.load(std::memory_order_acquire);
+		if (!node) return false;
+		fn(*node->data());
+		// the node becomes the sentinel, the old sentinel is handed back to the producer
+		node->data()->~Elem();
+		consumer.head.store(node, std::memory_order_release);
+		return true;
+	}
+
+	template<typename Elem, typename Alloc>
+	bool spsc_queue<Elem, Alloc>::empty() const noexcept
+	{
+		return !consumer.head.load(std::memory_order_acquire)->succ.load(std::memory_order_acquire);
+	}
+};
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
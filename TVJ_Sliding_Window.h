@@ -0,0 +1,508 @@
+/*
+ * File: TVJ_Sliding_Window.h
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include "TVJ_Forward_List.h"
+
+namespace tvj
+{
+	// the operation of tvj::sliding_window giving the smaller element
+	template<typename Elem>
+	struct window_min
+	{
+		inline const Elem& operator()(const Elem& a, const Elem& b) const
+		{
+			return b < a ? b : a;
+		}
+	};
+
+	// the operation of tvj::sliding_window giving the larger element
+	template<typename Elem>
+	struct window_max
+	{
+		inline const Elem& operator()(const Elem& a, const Elem& b) const
+		{
+			return a < b ? b : a;
+		}
+	};
+
+	// The tvj::sliding_window class
+	// that keeps timestamped samples in a singly linked list from the oldest to the newest,
+	// and the aggregate of the window by an associative Op (no inverse needed, e.g. window_min).
+	// The list is split into two stacks: each node of the older part keeps the aggregate from it to the end of that part,
+	// and each node of the newer part keeps the aggregate from the start of that part to it,
+	// the newer part is turned into the older one when the older one runs out, so all operations are amortized O(1).
+	// Expired nodes are cut as one chain and reused by push_back.
+	template<typename Elem, typename Op = std::plus<Elem>, typename Time = uint64_t, typename Alloc = std::allocator<Elem>>
+	class sliding_window
+	{
+	protected:
+		// the link of a node (the head sentinel only has the link)
+		struct Link
+		{
+			Link* succ = nullptr;
+		};
+
+		// the class of the window node
+		struct Node : Link
+		{
+			template<typename... Args>
+			Node(const Time& time_, Args&&... args);
+			Time time;
+			Elem data; // the sample
+			Elem agg;  // the aggregate of its part (see above)
+		};
+
+	public:
+		typedef Alloc allocator_type;
+
+	protected:
+		typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node> node_allocator;
+		typedef std::allocator_traits<node_allocator> node_traits;
+
+		// the link before the oldest node, which pop_front and expire cut from
+		struct Head : node_allocator, Link
+		{
+			Head(const node_allocator& alloc);
+		};
+
+		// the node of a link
+		static inline Node* _node(Link* link) noexcept;
+
+		// a recycled block of a node, connected by succ
+		struct Block
+		{
+			Block* succ;
+		};
+
+		// construct a node in a recycled or newly allocated block
+		template<typename... Args>
+		Node* _create_node(const Time& time_, Args&&... args);
+
+		// destroy the nodes of a chain [first, last] and keep them for recycling
+		void _recycle(Link* first, Link* last) noexcept;
+
+		// turn the newer part into the older part (the older part must be empty),
+		// if Op throws the links are restored and the aggregates are left stale
+		void _flip();
+
+		// remove the first n nodes
+		void _drop_front(size_t n);
+
+	private:
+		Head   head;
+		Op     op;
+		Link*  mid   = &head;   // the last node of the older part (&head if empty)
+		Link*  tail  = &head;   // the newest node (&head if empty)
+		Block* free_ = nullptr; // the recycled blocks
+		size_t size_ = 0;
+		bool   stale_ = false;  // the aggregates are invalid after Op threw in _flip (all nodes are in the newer part)
+
+	public:
+		/**
+		 * brief: constructor for empty window
+		 * param: the operation, the allocator
+		 * return: --
+		 */
+		explicit sliding_window(const Op& op_ = Op(), const Alloc& alloc = Alloc());
+
+		sliding_window(const sliding_window&) = delete;
+		sliding_window& operator=(const sliding_window&) = delete;
+
+		/**
+		 * @brief: destructor
+		 * @param: (void)
+		 * @return: --
+		 */
+		~sliding_window();
+
+		/**
+		 * brief: add a sample at the back in amortized O(1), the times must not decrease
+		 * param: the time, the sample
+		 * return: void
+		 */
+		inline void push_back(const Time& time, const Elem& elem);
+
+		/**
+		 * brief: construct a sample at the back in amortized O(1), the times must not decrease
+		 * param: the time, the arguments of the element constructor
+		 * return: void
+		 */
+		template<typename... Args>
+		void emplace_back(const Time& time, Args&&... args);
+
+		/**
+		 * brief: remove the oldest sample in amortized O(1)
+		 * param: (void)
+		 * return: void
+		 */
+		void pop_front();
+
+		/**
+		 * brief: remove all samples older than the time, they are cut as one chain
+		 * param: the time
+		 * return: size_t (number of removed samples)
+		 */
+		size_t expire_before(const Time& time);
+
+		/**
+		 * brief: the aggregate of all samples in O(1) (the window must not be empty)
+		 * param: (void)
+		 * return: Elem
+		 */
+		Elem aggregate() const;
+
+		/**
+		 * brief: the oldest sample
+		 * param: (void)
+		 * return: const Elem&
+		 */
+		inline const Elem& front() const;
+
+		/**
+		 * brief: the newest sample
+		 * param: (void)
+		 * return: const Elem&
+		 */
+		inline const Elem& back() const;
+
+		/**
+		 * brief: the time of the oldest sample
+		 * param: (void)
+		 * return: const Time&
+		 */
+		inline const Time& front_time() const;
+
+		/**
+		 * brief: visit the samples from the oldest to the newest
+		 * param: the function called with (const Time&, const Elem&)
+		 * return: void
+		 */
+		template<typename Function>
+		void for_each(Function fn) const;
+
+		/**
+		 * brief: prepare blocks for samples in advance
+		 * param: the number of blocks
+		 * return: void
+		 */
+		void reserve(size_t n);
+
+		/**
+		 * brief: remove all samples (the nodes are kept for recycling)
+		 * param: (void)
+		 * return: void
+		 */
+		void clear() noexcept;
+
+		/**
+		 * brief: the number of samples
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t size() const noexcept;
+
+		/**
+		 * brief: if the window is empty
+		 * param: (void)
+		 * return: bool
+		 */
+		inline bool empty() const noexcept;
+	};
+
+	template<typename Elem, typename Op, typename Time, typename Alloc> template<typename... Args>
+	sliding_window<Elem, Op, Time, Alloc>::Node::Node(const Time& time_, Args&&... args) : time(time_), data(std::forward<Args>(args)...), agg(data) { }
+
+	template<typename Elem, typename Op, typename Time, typename Alloc>
+	sliding_window<Elem, Op, Time, Alloc>::Head::Head(const node_allocator& alloc) : node_allocator(alloc) { }
+
+	template<typename Elem, typename Op, typename Time, typename Alloc>
+	typename sliding_window<Elem, Op, Time, Alloc>::Node* sliding_window<Elem, Op, Time, Alloc>::_node(Link* link) noexcept
+	{
+		return static_cast<Node*>(link);
+	}
+
+	template<typename Elem, typename Op, typename Time, typename Alloc> template<typename... Args>
+	typename sliding_window<Elem, Op, Time, Alloc>::Node* sliding_window<Elem, Op, Time, Alloc>::_create_node(const Time& time_, Args&&... args)
+	{
+		node_allocator& alloc = head;
+		if (!free_)
+		{
+			Node* node = node_traits::allocate(alloc, 1);
+			try
+			{
+				node_traits::construct(alloc, node, time_, std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				node_traits::deallocate(alloc, node, 1);
+				throw;
+			}
+			return node;
+		}
+		void* block = free_;
+		auto next = free_->succ;
+		Node* node = static_cast<Node*>(block);
+		try
+		{
+			node_traits::construct(alloc, node, time_, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			::new (block) Block{ next };
+			throw;
+		}
+		free_ = next;
+		return node;
+	}
+
+	template<typename Elem, typename Op, typename Time, typename Alloc>
+	void sliding_window<Elem, Op, Time, Alloc>::_recycle(Link* first, Link* last) noexcept
+	{
+		node_allocator& alloc = head;
+		for (auto link = first; ; )
+		{
+			auto next = link->succ;
+			auto node = _node(link);
+			node_traits::destroy(alloc, node);
+			free_ = ::new (static_cast<void*>(node)) Block{ free_ };
+			if (link == last) break;
+			link = next;
+		}
+	}
+
+	template<typename Elem, typename Op, typename Time, typename Alloc>
+	void sliding_window<Elem, Op, Time, Alloc>::_flip()
+	{
+		// reverse the chain, then walk it from the newest node computing the aggregates and reverse it back
+		Link* newest = nullptr;
+		for (auto link = head.succ; link; )
+		{
+			auto next = link->succ;
+			link->succ = newest;
+			newest = link;
+			link = next;
+		}
+		Link* newer = nullptr;
+		auto link = newest;
+		try
+		{
+			while (link)
+			{
+				auto next = link->succ;
+				auto node = _node(link);
+				node->agg = newer ? op(node->data, _node(newer)->agg) : node->data;
+				link->succ = newer;
+				newer = link;
+				link = next;
+			}
+		}
+		catch (...)
+		{
+			// finish reversing the chain back without Op, the next flip recomputes the aggregates
+			while (link)
+			{
+				auto next = link->succ;
+				link->succ = newer;
+				newer = link;
+				link = next;
+			}
+			mid = &head;
+			stale_ = true;
+			throw;
+		}
+		mid = tail;
+		stale_ = false;
+	}
+
+	template<typename Elem, typename Op, typename Time, typename Alloc>
+	void sliding_window<Elem, Op, Time, Alloc>::_drop_front(size_t n)
+	{
+		if (!n) return;
+		auto first = head.succ;
+		auto last = first;
+		bool older_gone = last == mid;
+		for (size_t i = 1; i != n; i++)
+		{
+			last = last->succ;
+			older_gone = older_gone || last == mid;
+		}
+		head.succ = last->succ;
+		if (last == tail) tail = &head;
+		_recycle(first, last);
+		size_ -= n;
+		if (older_gone || mid == &head)
+		{
+			// the rest (if any) is in the newer part whose aggregates may now include removed nodes
+			mid = &head;
+			if (head.succ) _flip();
+		}
+	}
+
+	template<typename Elem, typename Op, typename Time, typename Alloc>
+	sliding_window<Elem, Op, Time, Alloc>::sliding_window(const Op& op_, const Alloc& alloc) : head(node_allocator(alloc)), op(op_) { }
+
+	template<typename Elem, typename Op, typename Time, typename Alloc>
+	sliding_window<Elem, Op, Time, Alloc>::~sliding_window()
+	{
+		clear();
+		node_allocator& alloc = head;
+		while (free_)
+		{
+			auto block = free_;
+			free_ = free_->succ;
+			node_traits::deallocate(alloc, static_cast<Node*>(static_cast<void*>(block)), 1);
+		}
+	}
+
+	template<typename Elem, typename Op, typename Time, typename Alloc>
+	void sliding_window<Elem, Op, Time, Alloc>::push_back(const Time& time, const Elem& elem)
+	{
+		emplace_back(time, elem);
+	}
+
+	template<typename Elem, typename Op, typename Time, typename Alloc> template<typename... Args>
+	void sliding_window<Elem, Op, Time, Alloc>::emplace_back(const Time& time, Args&&... args)
+	{
+#ifndef NDEBUG
+		if (tail != &head && time < _node(tail)->time) error_info("Decreasing time in push_back of tvj::sliding_window.", TVJ_FORWARD_LIST_ITER_RANGE);
+#endif
+		auto node = _create_node(time, std::forward<Args>(args)...);
+		if (tail != mid && !stale_)
+		{
+			try
+			{
+				node->agg = op(_node(tail)->agg, node->data);
+			}
+			catch (...)
+			{
+				_recycle(node, node);
+				throw;
+			}
+		}
+		tail->succ = node;
+		tail = node;
+		size_++;
+	}
+
+	template<typename Elem, typename Op, typename Time, typename Alloc>
+	void sliding_window<Elem, Op, Time, Alloc>::pop_front()
+	{
+#ifndef NDEBUG
+		if (!size_) error_info("Pop from an empty tvj::sliding_window.", TVJ_FORWARD_LIST_UNDERFLOW);
+#endif
+		_drop_front(1);
+	}
+
+	template<typename Elem, typename Op, typename Time, typename Alloc>
+	size_t sliding_window<Elem, Op, Time, Alloc>::expire_before(const Time& time)
+	{
+		size_t n = 0;
+		for (auto link = head.succ; link && _node(link)->time < time; link = link->succ) n++;
+		_drop_front(n);
+		return n;
+	}
+
+	template<typename Elem, typename Op, typename Time, typename Alloc>
+	Elem sliding_window<Elem, Op, Time, Alloc>::aggregate() const
+	{
+#ifndef NDEBUG
+		if (!size_) error_info("Aggregate of an empty tvj::sliding_window.", TVJ_FORWARD_LIST_UNDERFLOW);
+#endif
+		if (stale_)
+		{
+			// fold the whole window, the aggregates are recomputed by the next flip
+			auto link = head.succ;
+			Elem agg = _node(link)->data;
+			for (link = link->succ; link; link = link->succ) agg = op(agg, _node(link)->data);
+			return agg;
+		}
+		if (mid == &head) return _node(tail)->agg;
+		if (mid == tail)  return _node(head.succ)->agg;
+		return op(_node(head.succ)->agg, _node(tail)->agg);
+	}
+
+	template<typename Elem, typename Op, typename Time, typename Alloc>
+	const Elem& sliding_window<Elem, Op, Time, Alloc>::front() const
+	{
+#ifndef NDEBUG
+		if (!size_) error_info("Front of an empty tvj::sliding_window.", TVJ_FORWARD_LIST_UNDERFLOW);
+#endif
+		return _node(head.succ)->data;
+	}
+
+	template<typename Elem, typename Op, typename Time, typename Alloc>
+	const Elem& sliding_window<Elem, Op, Time, Alloc>::back() const
+	{
+#ifndef NDEBUG
+		if (!size_) error_info("Back of an empty tvj::sliding_window.", TVJ_FORWARD_LIST_UNDERFLOW);
+#endif
+		return _node(tail)->data;
+	}
+
+	template<typename Elem, typename Op, typename Time, typename Alloc>
+	const Time& sliding_window<Elem, Op, Time, Alloc>::front_time() const
+	{
+#ifndef NDEBUG
+		if (!size_) error_info("Front time of an empty tvj::sliding_window.", TVJ_FORWARD_LIST_UNDERFLOW);
+#endif
+		return _node(head.succ)->time;
+	}
+
+	template<typename Elem, typename Op, typename Time, typename Alloc> template<typename Function>
+	void sliding_window<Elem, Op, Time, Alloc>::for_each(Function fn) const
+	{
+		for (auto link = head.succ; link; link = link->succ) fn(const_cast<const Time&>(_node(link)->time), const_cast<const Elem&>(_node(link)->data));
+	}
+
+	template<typename Elem, typename Op, typename Time, typename Alloc>
+	void sliding_window<Elem, Op, Time, Alloc>::reserve(size_t n)
+	{
+		node_allocator& alloc = head;
+		for (; n; n--)
+		{
+			free_ = ::new (static_cast<void*>(node_traits::allocate(alloc, 1))) Block{ free_ };
+		}
+	}
+
+	template<typename Elem, typename Op, typename Time, typename Alloc>
+	void sliding_window<Elem, Op, Time, Alloc>::clear() noexcept
+	{
+		if (head.succ) _recycle(head.succ, tail);
+		head.succ = nullptr;
+		mid = tail = &head;
+		size_ = 0;
+		stale_ = false;
+	}
+
+	template<typename Elem, typename Op, typename Time, typename Alloc>
+	size_t sliding_window<Elem, Op, Time, Alloc>::size() const noexcept
+	{
+		return size_;
+	}
+
+	template<typename Elem, typename Op, typename Time, typename Alloc>
+	bool sliding_window<Elem, Op, Time, Alloc>::empty() const noexcept
+	{
+		return !size_;
+	}
+};
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
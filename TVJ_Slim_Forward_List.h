@@ -0,0 +1,781 @@
+/*
+ * File: TVJ_Slim_Forward_List.h
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include "TVJ_Forward_List.h"
+
+namespace tvj
+{
+	// The tvj::slim_forward_list class
+	// that only holds the pointer to the first node (one word with a stateless allocator),
+	// it has no sentinel nodes and the size is counted on demand,
+	// which suits millions of tiny lists such as hash table buckets.
+	template<typename Elem, typename Alloc = std::allocator<Elem>>
+	class slim_forward_list
+	{
+	protected:
+		// the link of a node, before_begin() points to the link in the list object
+		struct Link
+		{
+			Link* succ = nullptr;
+		};
+
+		// the class of the list node
+		struct Node : Link
+		{
+			template<typename... Args>
+			Node(Link* succ_, Args&&... args);
+			Elem data; // the data the node contains
+		};
+
+	public:
+		typedef Alloc allocator_type;
+
+	protected:
+		typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node> node_allocator;
+		typedef std::allocator_traits<node_allocator> node_traits;
+
+		// the only member, a stateless allocator adds no size to the pointer to the first node
+		struct Head : node_allocator, Link
+		{
+			Head(const node_allocator& alloc);
+		};
+
+		// allocate and construct a node after succ_ with the allocator
+		template<typename... Args>
+		Node* _create_node(Link* succ_, Args&&... args);
+
+		// destroy and deallocate a node with the allocator
+		void _destroy_node(Link* node) noexcept;
+
+		// sort and merge relink the nullptr-terminated chain after head
+		typedef chain_sort<Link, Node> _chain;
+
+		// the strict order used by sort and merge
+		typedef typename _chain::order _order;
+
+		// append copies of the elements of [first, last) after node pos
+		template<typename _Iter>
+		void _copy_after(Link* pos, _Iter first, const _Iter& last);
+
+	private:
+		Head head;
+
+	public:
+		class const_iterator
+		{
+			friend class slim_forward_list<Elem, Alloc>;
+
+		protected:
+			Link* node;
+
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef Elem                      value_type;
+			typedef std::ptrdiff_t            difference_type;
+			typedef const Elem*               pointer;
+			typedef const Elem&               reference;
+
+			const_iterator(Link* node_ = nullptr) noexcept;
+		public:
+			inline const Elem& operator*() const;
+			inline const Elem* operator->() const;
+			inline const_iterator& operator++();
+			inline const_iterator operator++(int);
+			inline bool operator==(const const_iterator& iter) const noexcept;
+			inline bool operator!=(const const_iterator& iter) const noexcept;
+		};
+
+		class iterator : public const_iterator
+		{
+		public:
+			typedef Elem* pointer;
+			typedef Elem& reference;
+
+			// constructor declaration
+			using const_iterator::const_iterator;
+			inline Elem& operator*() const;
+			inline Elem* operator->() const;
+			inline iterator& operator++();
+			inline iterator operator++(int);
+		};
+
+	public:
+		/**
+		 * brief: constructor for empty list
+		 * param: (void)
+		 * return: --
+		 */
+		slim_forward_list();
+
+		/**
+		 * brief: constructor for empty list using the allocator
+		 * param: the allocator
+		 * return: --
+		 */
+		explicit slim_forward_list(const Alloc& alloc);
+
+		/**
+		 * brief: constructor for an initializer list
+		 * param: the elements, the allocator
+		 * return: --
+		 */
+		slim_forward_list(std::initializer_list<Elem> elems, const Alloc& alloc = Alloc());
+
+		/**
+		 * brief: copy constructor (the allocator is selected by select_on_container_copy_construction)
+		 * param: another list
+		 * return: --
+		 */
+		slim_forward_list(const slim_forward_list& list_);
+
+		/**
+		 * brief: move constructor (the allocator is moved with the nodes)
+		 * param: another list
+		 * return: --
+		 */
+		slim_forward_list(slim_forward_list&& list_) noexcept;
+
+		/**
+		 * @brief: destructor
+		 * @param: (void)
+		 * @return: --
+		 */
+		~slim_forward_list();
+
+		/**
+		 * brief: copy assignment (the allocator is kept)
+		 * param: another list
+		 * return: slim_forward_list&
+		 */
+		slim_forward_list& operator=(const slim_forward_list& list_);
+
+		/**
+		 * brief: move assignment, the nodes are taken if the allocators are equal,
+		 *        otherwise the elements are moved one by one
+		 * param: another list
+		 * return: slim_forward_list&
+		 */
+		slim_forward_list& operator=(slim_forward_list&& list_);
+
+		/**
+		 * brief: exchange the nodes with another list (the allocators must be equal)
+		 * param: another list
+		 * return: void
+		 */
+		void swap(slim_forward_list& list_) noexcept;
+
+		/**
+		 * brief: the allocator of the list
+		 * param: (void)
+		 * return: allocator_type
+		 */
+		inline allocator_type get_allocator() const;
+
+		/**
+		 * brief: clear all elements in the list
+		 * param: (void)
+		 * return: void
+		 */
+		void clear() noexcept;
+
+		/**
+		 * brief: if the list is empty
+		 * param: (void)
+		 * return: bool
+		 */
+		inline bool empty() const noexcept;
+
+		/**
+		 * brief: the size counted by traversal, O(n)
+		 * param: (void)
+		 * return: size_t
+		 */
+		size_t size() const noexcept;
+
+		/**
+		 * brief: the iterator before begin()
+		 * param: (void)
+		 * return: iterator
+		 */
+		inline iterator before_begin() noexcept;
+
+		/**
+		 * brief: the iterator begin()
+		 * param: (void)
+		 * return: iterator
+		 */
+		inline iterator begin() noexcept;
+
+		/**
+		 * brief: the iterator end() that is one past the last element
+		 * param: (void)
+		 * return: iterator
+		 */
+		inline iterator end() noexcept;
+
+		/**
+		 * brief: the iterator before begin()
+		 * param: (void)
+		 * return: const_iterator
+		 */
+		inline const_iterator before_begin() const noexcept;
+
+		/**
+		 * brief: the iterator begin()
+		 * param: (void)
+		 * return: const_iterator
+		 */
+		inline const_iterator begin() const noexcept;
+
+		/**
+		 * brief: the iterator end() that is one past the last element
+		 * param: (void)
+		 * return: const_iterator
+		 */
+		inline const_iterator end() const noexcept;
+
+		/**
+		 * brief: the iterator before begin()
+		 * param: (void)
+		 * return: const_iterator
+		 */
+		inline const_iterator cbefore_begin() const noexcept;
+
+		/**
+		 * brief: the iterator begin()
+		 * param: (void)
+		 * return: const_iterator
+		 */
+		inline const_iterator cbegin() const noexcept;
+
+		/**
+		 * brief: the iterator end() that is one past the last element
+		 * param: (void)
+		 * return: const_iterator
+		 */
+		inline const_iterator cend() const noexcept;
+
+		/**
+		 * brief: find the element and return its iterator of first occurence,
+		 *        if no result found, return end()
+		 * param: the element type
+		 * return: iterator
+		 */
+		iterator find(const Elem& elem) noexcept;
+
+		/**
+		 * brief: find the element and return its iterator of first occurence,
+		 *        if no result found, return cend()
+		 * param: the element type
+		 * return: const_iterator
+		 */
+		const_iterator find(const Elem& elem) const noexcept;
+
+		/**
+		 * brief: insert a new element before the first element
+		 * param: the element type
+		 * return: void
+		 */
+		inline void push_front(const Elem& elem);
+
+		/**
+		 * brief: insert a new element before the first element
+		 * param: the element type
+		 * return: void
+		 */
+		inline void push_front(Elem&& elem);
+
+		/**
+		 * brief: construct a new element before the first element
+		 * param: the arguments of the element constructor
+		 * return: void
+		 */
+		template<typename... Args>
+		inline void emplace_front(Args&&... args);
+
+		/**
+		 * brief: remove the first element
+		 * param: (void)
+		 * return: void
+		 */
+		inline void pop_front();
+
+		/**
+		 * brief: insert a new element after the iterator
+		 * param: the iterator and the element
+		 * return: iterator (the new element)
+		 */
+		inline iterator insert_after(const const_iterator& iter, const Elem& elem);
+
+		/**
+		 * brief: insert a new element after the iterator
+		 * param: the iterator and the element
+		 * return: iterator (the new element)
+		 */
+		inline iterator insert_after(const const_iterator& iter, Elem&& elem);
+
+		/**
+		 * brief: construct a new element after the iterator
+		 * param: the iterator, the arguments of the element constructor
+		 * return: iterator (the new element)
+		 */
+		template<typename... Args>
+		inline iterator emplace_after(const const_iterator& iter, Args&&... args);
+
+		/**
+		 * brief: erase the element after the iterator
+		 * param: the iterator
+		 * return: iterator (the one after the erased element)
+		 */
+		iterator erase_after(const const_iterator& iter);
+
+		/**
+		 * brief: erase the elements in the range (iter1, iter2)
+		 * param: two iterators
+		 * return: iterator (iter2)
+		 */
+		iterator erase_after(const const_iterator& iter1, const const_iterator& iter2);
+
+		/**
+		 * brief: remove the elements satisfying the predicate
+		 * param: the predicate
+		 * return: size_t (number of removed elements)
+		 */
+		template<typename Predicate>
+		size_t remove_if(Predicate pred);
+
+		/**
+		 * brief: the stable merge sort by relinking the nodes
+		 * param: the sorting order (default as ASCENDING, otherwise DESCENDING)
+		 * return: void
+		 */
+		void sort(bool is_ascending = ASCENDING);
+
+		/**
+		 * brief: merge another sorted list by relinking its nodes (list_ becomes empty),
+		 *        the allocators must be equal
+		 * param: another list with the same element type, the sorting order (default as ASCENDING, otherwise DESCENDING)
+		 * return: void
+		 */
+		void merge(slim_forward_list& list_, bool is_ascending = ASCENDING);
+	};
+
+	template<typename Elem, typename Alloc> template<typename... Args>
+	slim_forward_list<Elem, Alloc>::Node::Node(Link* succ_, Args&&... args) : data(std::forward<Args>(args)...)
+	{
+		this->succ = succ_;
+	}
+
+	template<typename Elem, typename Alloc>
+	slim_forward_list<Elem, Alloc>::Head::Head(const node_allocator& alloc) : node_allocator(alloc) { }
+
+	template<typename Elem, typename Alloc> template<typename... Args>
+	typename slim_forward_list<Elem, Alloc>::Node* slim_forward_list<Elem, Alloc>::_create_node(Link* succ_, Args&&... args)
+	{
+		node_allocator& alloc = head;
+		Node* node = node_traits::allocate(alloc, 1);
+		try
+		{
+			node_traits::construct(alloc, node, succ_, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			node_traits::deallocate(alloc, node, 1);
+			throw;
+		}
+		return node;
+	}
+
+	template<typename Elem, typename Alloc>
+	void slim_forward_list<Elem, Alloc>::_destroy_node(Link* node) noexcept
+	{
+		node_allocator& alloc = head;
+		auto node_ = static_cast<Node*>(node);
+		node_traits::destroy(alloc, node_);
+		node_traits::deallocate(alloc, node_, 1);
+	}
+
+	template<typename Elem, typename Alloc> template<typename _Iter>
+	void slim_forward_list<Elem, Alloc>::_copy_after(Link* pos, _Iter first, const _Iter& last)
+	{
+		for (; first != last; ++first) pos = pos->succ = _create_node(pos->succ, *first);
+	}
+
+	template<typename Elem, typename Alloc>
+	slim_forward_list<Elem, Alloc>::const_iterator::const_iterator(Link* node_) noexcept : node(node_) { }
+
+	template<typename Elem, typename Alloc>
+	const Elem& slim_forward_list<Elem, Alloc>::const_iterator::operator*() const
+	{
+#ifndef NDEBUG
+		if (!node) error_info("Dereference of end() of tvj::slim_forward_list.", TVJ_FORWARD_LIST_NULLPTR);
+#endif
+		return static_cast<Node*>(node)->data;
+	}
+
+	template<typename Elem, typename Alloc>
+	const Elem* slim_forward_list<Elem, Alloc>::const_iterator::operator->() const
+	{
+		return &**this;
+	}
+
+	template<typename Elem, typename Alloc>
+	typename slim_forward_list<Elem, Alloc>::const_iterator& slim_forward_list<Elem, Alloc>::const_iterator::operator++()
+	{
+#ifndef NDEBUG
+		if (!node) error_info("Increment of end() of tvj::slim_forward_list.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		node = node->succ;
+		return *this;
+	}
+
+	template<typename Elem, typename Alloc>
+	typename slim_forward_list<Elem, Alloc>::const_iterator slim_forward_list<Elem, Alloc>::const_iterator::operator++(int)
+	{
+		auto ret = *this;
+		++*this;
+		return ret;
+	}
+
+	template<typename Elem, typename Alloc>
+	bool slim_forward_list<Elem, Alloc>::const_iterator::operator==(const const_iterator& iter) const noexcept
+	{
+		return node == iter.node;
+	}
+
+	template<typename Elem, typename Alloc>
+	bool slim_forward_list<Elem, Alloc>::const_iterator::operator!=(const const_iterator& iter) const noexcept
+	{
+		return node != iter.node;
+	}
+
+	template<typename Elem, typename Alloc>
+	Elem& slim_forward_list<Elem, Alloc>::iterator::operator*() const
+	{
+		return const_cast<Elem&>(const_iterator::operator*());
+	}
+
+	template<typename Elem, typename Alloc>
+	Elem* slim_forward_list<Elem, Alloc>::iterator::operator->() const
+	{
+		return &**this;
+	}
+
+	template<typename Elem, typename Alloc>
+	typename slim_forward_list<Elem, Alloc>::iterator& slim_forward_list<Elem, Alloc>::iterator::operator++()
+	{
+		const_iterator::operator++();
+		return *this;
+	}
+
+	template<typename Elem, typename Alloc>
+	typename slim_forward_list<Elem, Alloc>::iterator slim_forward_list<Elem, Alloc>::iterator::operator++(int)
+	{
+		auto ret = *this;
+		++*this;
+		return ret;
+	}
+
+	template<typename Elem, typename Alloc>
+	slim_forward_list<Elem, Alloc>::slim_forward_list() : head(node_allocator()) { }
+
+	template<typename Elem, typename Alloc>
+	slim_forward_list<Elem, Alloc>::slim_forward_list(const Alloc& alloc) : head(node_allocator(alloc)) { }
+
+	template<typename Elem, typename Alloc>
+	slim_forward_list<Elem, Alloc>::slim_forward_list(std::initializer_list<Elem> elems, const Alloc& alloc) : head(node_allocator(alloc))
+	{
+		_copy_after(&head, elems.begin(), elems.end());
+	}
+
+	template<typename Elem, typename Alloc>
+	slim_forward_list<Elem, Alloc>::slim_forward_list(const slim_forward_list& list_)
+		: head(node_traits::select_on_container_copy_construction(list_.head))
+	{
+		_copy_after(&head, list_.cbegin(), list_.cend());
+	}
+
+	template<typename Elem, typename Alloc>
+	slim_forward_list<Elem, Alloc>::slim_forward_list(slim_forward_list&& list_) noexcept : head(std::move(static_cast<node_allocator&>(list_.head)))
+	{
+		head.succ = list_.head.succ;
+		list_.head.succ = nullptr;
+	}
+
+	template<typename Elem, typename Alloc>
+	slim_forward_list<Elem, Alloc>::~slim_forward_list()
+	{
+		clear();
+	}
+
+	template<typename Elem, typename Alloc>
+	slim_forward_list<Elem, Alloc>& slim_forward_list<Elem, Alloc>::operator=(const slim_forward_list& list_)
+	{
+		if (&list_ == this) return *this;
+		clear();
+		_copy_after(&head, list_.cbegin(), list_.cend());
+		return *this;
+	}
+
+	template<typename Elem, typename Alloc>
+	slim_forward_list<Elem, Alloc>& slim_forward_list<Elem, Alloc>::operator=(slim_forward_list&& list_)
+	{
+		if (&list_ == this) return *this;
+		clear();
+		if (static_cast<node_allocator&>(head) == static_cast<node_allocator&>(list_.head))
+		{
+			head.succ = list_.head.succ;
+			list_.head.succ = nullptr;
+			return *this;
+		}
+		Link* pos = &head;
+		for (auto& elem : list_) pos = pos->succ = _create_node(nullptr, std::move(elem));
+		list_.clear();
+		return *this;
+	}
+
+	template<typename Elem, typename Alloc>
+	void slim_forward_list<Elem, Alloc>::swap(slim_forward_list& list_) noexcept
+	{
+		std::swap(head.succ, list_.head.succ);
+	}
+
+	template<typename Elem, typename Alloc>
+	typename slim_forward_list<Elem, Alloc>::allocator_type slim_forward_list<Elem, Alloc>::get_allocator() const
+	{
+		return allocator_type(static_cast<const node_allocator&>(head));
+	}
+
+	template<typename Elem, typename Alloc>
+	void slim_forward_list<Elem, Alloc>::clear() noexcept
+	{
+		while (head.succ)
+		{
+			auto node = head.succ;
+			head.succ = node->succ;
+			_destroy_node(node);
+		}
+	}
+
+	template<typename Elem, typename Alloc>
+	bool slim_forward_list<Elem, Alloc>::empty() const noexcept
+	{
+		return !head.succ;
+	}
+
+	template<typename Elem, typename Alloc>
+	size_t slim_forward_list<Elem, Alloc>::size() const noexcept
+	{
+		size_t n = 0;
+		for (auto node = head.succ; node; node = node->succ) n++;
+		return n;
+	}
+
+	template<typename Elem, typename Alloc>
+	typename slim_forward_list<Elem, Alloc>::iterator slim_forward_list<Elem, Alloc>::before_begin() noexcept
+	{
+		return iterator(&head);
+	}
+
+	template<typename Elem, typename Alloc>
+	typename slim_forward_list<Elem, Alloc>::iterator slim_forward_list<Elem, Alloc>::begin() noexcept
+	{
+		return iterator(head.succ);
+	}
+
+	template<typename Elem, typename Alloc>
+	typename slim_forward_list<Elem, Alloc>::iterator slim_forward_list<Elem, Alloc>::end() noexcept
+	{
+		return iterator(nullptr);
+	}
+
+	template<typename Elem, typename Alloc>
+	typename slim_forward_list<Elem, Alloc>::const_iterator slim_forward_list<Elem, Alloc>::before_begin() const noexcept
+	{
+		return const_iterator(const_cast<Head*>(&head));
+	}
+
+	template<typename Elem, typename Alloc>
+	typename slim_forward_list<Elem, Alloc>::const_iterator slim_forward_list<Elem, Alloc>::begin() const noexcept
+	{
+		return const_iterator(head.succ);
+	}
+
+	template<typename Elem, typename Alloc>
+	typename slim_forward_list<Elem, Alloc>::const_iterator slim_forward_list<Elem, Alloc>::end() const noexcept
+	{
+		return const_iterator(nullptr);
+	}
+
+	template<typename Elem, typename Alloc>
+	typename slim_forward_list<Elem, Alloc>::const_iterator slim_forward_list<Elem, Alloc>::cbefore_begin() const noexcept
+	{
+		return before_begin();
+	}
+
+	template<typename Elem, typename Alloc>
+	typename slim_forward_list<Elem, Alloc>::const_iterator slim_forward_list<Elem, Alloc>::cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	template<typename Elem, typename Alloc>
+	typename slim_forward_list<Elem, Alloc>::const_iterator slim_forward_list<Elem, Alloc>::cend() const noexcept
+	{
+		return end();
+	}
+
+	template<typename Elem, typename Alloc>
+	typename slim_forward_list<Elem, Alloc>::iterator slim_forward_list<Elem, Alloc>::find(const Elem& elem) noexcept
+	{
+		auto node = head.succ;
+		while (node && !(static_cast<Node*>(node)->data == elem)) node = node->succ;
+		return iterator(node);
+	}
+
+	template<typename Elem, typename Alloc>
+	typename slim_forward_list<Elem, Alloc>::const_iterator slim_forward_list<Elem, Alloc>::find(const Elem& elem) const noexcept
+	{
+		return const_cast<slim_forward_list*>(this)->find(elem);
+	}
+
+	template<typename Elem, typename Alloc>
+	void slim_forward_list<Elem, Alloc>::push_front(const Elem& elem)
+	{
+		head.succ = _create_node(head.succ, elem);
+	}
+
+	template<typename Elem, typename Alloc>
+	void slim_forward_list<Elem, Alloc>::push_front(Elem&& elem)
+	{
+		head.succ = _create_node(head.succ, std::move(elem));
+	}
+
+	template<typename Elem, typename Alloc> template<typename... Args>
+	void slim_forward_list<Elem, Alloc>::emplace_front(Args&&... args)
+	{
+		head.succ = _create_node(head.succ, std::forward<Args>(args)...);
+	}
+
+	template<typename Elem, typename Alloc>
+	void slim_forward_list<Elem, Alloc>::pop_front()
+	{
+#ifndef NDEBUG
+		if (empty()) error_info("Pop from an empty tvj::slim_forward_list.", TVJ_FORWARD_LIST_UNDERFLOW);
+#endif
+		erase_after(cbefore_begin());
+	}
+
+	template<typename Elem, typename Alloc>
+	typename slim_forward_list<Elem, Alloc>::iterator slim_forward_list<Elem, Alloc>::insert_after(const const_iterator& iter, const Elem& elem)
+	{
+		return emplace_after(iter, elem);
+	}
+
+	template<typename Elem, typename Alloc>
+	typename slim_forward_list<Elem, Alloc>::iterator slim_forward_list<Elem, Alloc>::insert_after(const const_iterator& iter, Elem&& elem)
+	{
+		return emplace_after(iter, std::move(elem));
+	}
+
+	template<typename Elem, typename Alloc> template<typename... Args>
+	typename slim_forward_list<Elem, Alloc>::iterator slim_forward_list<Elem, Alloc>::emplace_after(const const_iterator& iter, Args&&... args)
+	{
+#ifndef NDEBUG
+		if (!iter.node) error_info("Insert after end() of tvj::slim_forward_list.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		return iterator(iter.node->succ = _create_node(iter.node->succ, std::forward<Args>(args)...));
+	}
+
+	template<typename Elem, typename Alloc>
+	typename slim_forward_list<Elem, Alloc>::iterator slim_forward_list<Elem, Alloc>::erase_after(const const_iterator& iter)
+	{
+#ifndef NDEBUG
+		if (!iter.node || !iter.node->succ) error_info("Erase after the last element of tvj::slim_forward_list.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		auto node = iter.node->succ;
+		iter.node->succ = node->succ;
+		_destroy_node(node);
+		return iterator(iter.node->succ);
+	}
+
+	template<typename Elem, typename Alloc>
+	typename slim_forward_list<Elem, Alloc>::iterator slim_forward_list<Elem, Alloc>::erase_after(const const_iterator& iter1, const const_iterator& iter2)
+	{
+#ifndef NDEBUG
+		if (!iter1.node) error_info("Erase after end() of tvj::slim_forward_list.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		auto node = iter1.node->succ;
+		while (node != iter2.node)
+		{
+#ifndef NDEBUG
+			if (!node) error_info("Invalid range in function erase_after of tvj::slim_forward_list.", TVJ_FORWARD_LIST_ITER_RANGE);
+#endif
+			auto to_delete = node;
+			node = node->succ;
+			_destroy_node(to_delete);
+		}
+		iter1.node->succ = iter2.node;
+		return iterator(iter2.node);
+	}
+
+	template<typename Elem, typename Alloc> template<typename Predicate>
+	size_t slim_forward_list<Elem, Alloc>::remove_if(Predicate pred)
+	{
+		size_t removed = 0;
+		Link* prev = &head;
+		while (prev->succ)
+		{
+			auto node = prev->succ;
+			if (pred(static_cast<Node*>(node)->data))
+			{
+				prev->succ = node->succ;
+				_destroy_node(node);
+				removed++;
+			}
+			else prev = node;
+		}
+		return removed;
+	}
+
+	template<typename Elem, typename Alloc>
+	void slim_forward_list<Elem, Alloc>::sort(bool is_ascending)
+	{
+		const size_t n = size();
+		if (n < 2) return;
+		Link* rest = head.succ;
+		head.succ = _chain::sort(rest, n, _order{ is_ascending });
+	}
+
+	template<typename Elem, typename Alloc>
+	void slim_forward_list<Elem, Alloc>::merge(slim_forward_list& list_, bool is_ascending)
+	{
+		if (&list_ == this) return;
+#ifndef NDEBUG
+		if (!(static_cast<node_allocator&>(head) == static_cast<node_allocator&>(list_.head)))
+			error_info("Merge between tvj::slim_forward_list with unequal allocators.", TVJ_FORWARD_LIST_TYPE_MISMATCH);
+#endif
+		head.succ = _chain::merge(head.succ, list_.head.succ, _order{ is_ascending });
+		list_.head.succ = nullptr;
+	}
+};
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
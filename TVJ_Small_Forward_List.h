@@ -0,0 +1,838 @@
+/*
+ * File: TVJ_Small_Forward_List.h
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include "TVJ_Forward_List.h"
+
+namespace tvj
+{
+	// The tvj::small_forward_list class
+	// that keeps up to N nodes inline in the list object and allocates the others by Alloc,
+	// the inline and heap nodes are linked into one chain so that all functions work across them.
+	// Moving the list moves the elements of the inline nodes and relinks the heap nodes
+	// (all elements are moved one by one if the allocators are unequal).
+	template<typename Elem, size_t N = 4, typename Alloc = std::allocator<Elem>>
+	class small_forward_list
+	{
+		static_assert(N > 0, "tvj::small_forward_list needs at least one inline node.");
+
+	protected:
+		// the link of a node, before_begin() points to the link in the list object
+		struct Link
+		{
+			Link* succ = nullptr;
+		};
+
+		// the class of the list node
+		struct Node : Link
+		{
+			template<typename... Args>
+			Node(Args&&... args);
+			Elem data; // the data the node contains
+		};
+
+	public:
+		typedef Alloc allocator_type;
+
+	protected:
+		typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node> node_allocator;
+		typedef std::allocator_traits<node_allocator> node_traits;
+
+		// the link before the first node (inline or heap), with the allocator used for the heap nodes
+		struct Head : node_allocator, Link
+		{
+			Head(const node_allocator& alloc);
+		};
+
+		// whether the node is one of the inline nodes
+		inline bool _is_inline(const Link* node) const noexcept;
+
+		// construct a node in a free inline slot, or allocate it if there is none
+		template<typename... Args>
+		Node* _create_node(Args&&... args);
+
+		// destroy a node and return it to the inline slots or the allocator
+		void _destroy_node(Link* node) noexcept;
+
+		// take over the nodes of list_ as a nullptr-terminated chain owned by *this (list_ becomes empty),
+		// the heap nodes are relinked if the allocators are equal and the other elements are moved,
+		// if moving an element throws, the nodes taken so far are appended to *this
+		Link* _adopt(small_forward_list& list_);
+
+		// sort and merge relink the nullptr-terminated chain after head
+		typedef chain_sort<Link, Node> _chain;
+
+		// the strict order used by sort and merge
+		typedef typename _chain::order _order;
+
+		// relink the chain after head and update last
+		void _relink(Link* first) noexcept;
+
+	private:
+		Head   head;
+		Link*  last;                  // the last node (&head if empty)
+		size_t size_ = 0;
+		Link*  inline_free = nullptr; // the chain of released inline slots
+		size_t inline_used = 0;       // the inline slots ever used (the others are not in inline_free)
+		alignas(Node) unsigned char inline_nodes[N * sizeof(Node)];
+
+	public:
+		class const_iterator
+		{
+			friend class small_forward_list<Elem, N, Alloc>;
+
+		protected:
+			Link* node;
+
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef Elem                      value_type;
+			typedef std::ptrdiff_t            difference_type;
+			typedef const Elem*               pointer;
+			typedef const Elem&               reference;
+
+			const_iterator(Link* node_ = nullptr) noexcept;
+		public:
+			inline const Elem& operator*() const;
+			inline const Elem* operator->() const;
+			inline const_iterator& operator++();
+			inline const_iterator operator++(int);
+			inline bool operator==(const const_iterator& iter) const noexcept;
+			inline bool operator!=(const const_iterator& iter) const noexcept;
+		};
+
+		class iterator : public const_iterator
+		{
+		public:
+			typedef Elem* pointer;
+			typedef Elem& reference;
+
+			// constructor declaration
+			using const_iterator::const_iterator;
+			inline Elem& operator*() const;
+			inline Elem* operator->() const;
+			inline iterator& operator++();
+			inline iterator operator++(int);
+		};
+
+	public:
+		/**
+		 * brief: constructor for empty list
+		 * param: (void)
+		 * return: --
+		 */
+		small_forward_list();
+
+		/**
+		 * brief: constructor for empty list using the allocator
+		 * param: the allocator
+		 * return: --
+		 */
+		explicit small_forward_list(const Alloc& alloc);
+
+		/**
+		 * brief: constructor for an initializer list
+		 * param: the elements, the allocator
+		 * return: --
+		 */
+		small_forward_list(std::initializer_list<Elem> elems, const Alloc& alloc = Alloc());
+
+		/**
+		 * brief: copy constructor (the allocator is selected by select_on_container_copy_construction)
+		 * param: another list
+		 * return: --
+		 */
+		small_forward_list(const small_forward_list& list_);
+
+		/**
+		 * brief: move constructor, the heap nodes are relinked and the inline elements are moved
+		 * param: another list
+		 * return: --
+		 */
+		small_forward_list(small_forward_list&& list_);
+
+		/**
+		 * @brief: destructor
+		 * @param: (void)
+		 * @return: --
+		 */
+		~small_forward_list();
+
+		/**
+		 * brief: copy assignment (the allocator is kept)
+		 * param: another list
+		 * return: small_forward_list&
+		 */
+		small_forward_list& operator=(const small_forward_list& list_);
+
+		/**
+		 * brief: move assignment (the allocator is kept), the heap nodes are relinked
+		 *        if the allocators are equal and the other elements are moved
+		 * param: another list
+		 * return: small_forward_list&
+		 */
+		small_forward_list& operator=(small_forward_list&& list_);
+
+		/**
+		 * brief: the allocator of the list
+		 * param: (void)
+		 * return: allocator_type
+		 */
+		inline allocator_type get_allocator() const;
+
+		/**
+		 * brief: the number of inline nodes
+		 * param: (void)
+		 * return: size_t
+		 */
+		static constexpr size_t inline_capacity() noexcept;
+
+		/**
+		 * brief: clear all elements in the list
+		 * param: (void)
+		 * return: void
+		 */
+		void clear() noexcept;
+
+		/**
+		 * brief: the size (valid element number)
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t size() const noexcept;
+
+		/**
+		 * brief: if the list is empty
+		 * param: (void)
+		 * return: bool
+		 */
+		inline bool empty() const noexcept;
+
+		/**
+		 * brief: the iterator before begin()
+		 * param: (void)
+		 * return: iterator
+		 */
+		inline iterator before_begin() noexcept;
+
+		/**
+		 * brief: the iterator begin()
+		 * param: (void)
+		 * return: iterator
+		 */
+		inline iterator begin() noexcept;
+
+		/**
+		 * brief: the iterator back() that is the last valid element
+		 * param: (void)
+		 * return: iterator
+		 */
+		inline iterator back() noexcept;
+
+		/**
+		 * brief: the iterator end() that is one past the last element
+		 * param: (void)
+		 * return: iterator
+		 */
+		inline iterator end() noexcept;
+
+		/**
+		 * brief: the iterator before begin()
+		 * param: (void)
+		 * return: const_iterator
+		 */
+		inline const_iterator before_begin() const noexcept;
+
+		/**
+		 * brief: the iterator begin()
+		 * param: (void)
+		 * return: const_iterator
+		 */
+		inline const_iterator begin() const noexcept;
+
+		/**
+		 * brief: the iterator back() that is the last valid element
+		 * param: (void)
+		 * return: const_iterator
+		 */
+		inline const_iterator back() const noexcept;
+
+		/**
+		 * brief: the iterator end() that is one past the last element
+		 * param: (void)
+		 * return: const_iterator
+		 */
+		inline const_iterator end() const noexcept;
+
+		/**
+		 * brief: find the element and return its iterator of first occurence,
+		 *        if no result found, return end()
+		 * param: the element type
+		 * return: iterator
+		 */
+		iterator find(const Elem& elem) noexcept;
+
+		/**
+		 * brief: find the element and return its iterator of first occurence,
+		 *        if no result found, return end()
+		 * param: the element type
+		 * return: const_iterator
+		 */
+		const_iterator find(const Elem& elem) const noexcept;
+
+		/**
+		 * brief: insert a new element before the first element
+		 * param: the element type
+		 * return: void
+		 */
+		inline void push_front(const Elem& elem);
+
+		/**
+		 * brief: insert a new element at the end
+		 * param: the element type
+		 * return: void
+		 */
+		inline void push_back(const Elem& elem);
+
+		/**
+		 * brief: remove the first element
+		 * param: (void)
+		 * return: void
+		 */
+		inline void pop_front();
+
+		/**
+		 * brief: insert a new element after the iterator
+		 * param: the iterator and the element
+		 * return: iterator (the new element)
+		 */
+		iterator insert_after(const const_iterator& iter, const Elem& elem);
+
+		/**
+		 * brief: erase the element after the iterator
+		 * param: the iterator
+		 * return: iterator (the one after the erased element)
+		 */
+		iterator erase_after(const const_iterator& iter);
+
+		/**
+		 * brief: remove the elements satisfying the predicate
+		 * param: the predicate
+		 * return: size_t (number of removed elements)
+		 */
+		template<typename Predicate>
+		size_t remove_if(Predicate pred);
+
+		/**
+		 * brief: make the elements unique in a sorted list
+		 * param: (void)
+		 * return: void
+		 */
+		void unique();
+
+		/**
+		 * brief: the stable merge sort by relinking the nodes
+		 * param: the sorting order (default as ASCENDING, otherwise DESCENDING)
+		 * return: void
+		 */
+		void sort(bool is_ascending = ASCENDING);
+
+		/**
+		 * brief: merge another sorted list (list_ becomes empty), its heap nodes are relinked
+		 *        if the allocators are equal and its other elements are moved
+		 * param: another list with the same element type, the sorting order (default as ASCENDING, otherwise DESCENDING)
+		 * return: void
+		 */
+		void merge(small_forward_list& list_, bool is_ascending = ASCENDING);
+	};
+
+	template<typename Elem, size_t N, typename Alloc> template<typename... Args>
+	small_forward_list<Elem, N, Alloc>::Node::Node(Args&&... args) : data(std::forward<Args>(args)...) { }
+
+	template<typename Elem, size_t N, typename Alloc>
+	small_forward_list<Elem, N, Alloc>::Head::Head(const node_allocator& alloc) : node_allocator(alloc) { }
+
+	template<typename Elem, size_t N, typename Alloc>
+	bool small_forward_list<Elem, N, Alloc>::_is_inline(const Link* node) const noexcept
+	{
+		auto ptr = reinterpret_cast<const unsigned char*>(node);
+		return !std::less<const unsigned char*>()(ptr, inline_nodes) && std::less<const unsigned char*>()(ptr, inline_nodes + sizeof(inline_nodes));
+	}
+
+	template<typename Elem, size_t N, typename Alloc> template<typename... Args>
+	typename small_forward_list<Elem, N, Alloc>::Node* small_forward_list<Elem, N, Alloc>::_create_node(Args&&... args)
+	{
+		void* slot = nullptr;
+		if (inline_free)
+		{
+			slot = inline_free;
+			inline_free = inline_free->succ;
+		}
+		else if (inline_used != N) slot = inline_nodes + inline_used++ * sizeof(Node);
+
+		if (slot)
+		{
+			try
+			{
+				return ::new (slot) Node(std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				auto link = ::new (slot) Link;
+				link->succ = inline_free;
+				inline_free = link;
+				throw;
+			}
+		}
+
+		node_allocator& alloc = head;
+		Node* node = node_traits::allocate(alloc, 1);
+		try
+		{
+			node_traits::construct(alloc, node, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			node_traits::deallocate(alloc, node, 1);
+			throw;
+		}
+		return node;
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	void small_forward_list<Elem, N, Alloc>::_destroy_node(Link* node) noexcept
+	{
+		auto node_ = static_cast<Node*>(node);
+		if (_is_inline(node))
+		{
+			node_->~Node();
+			auto link = ::new (static_cast<void*>(node_)) Link;
+			link->succ = inline_free;
+			inline_free = link;
+			return;
+		}
+		node_allocator& alloc = head;
+		node_traits::destroy(alloc, node_);
+		node_traits::deallocate(alloc, node_, 1);
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	typename small_forward_list<Elem, N, Alloc>::Link* small_forward_list<Elem, N, Alloc>::_adopt(small_forward_list& list_)
+	{
+		// a heap node can only be freed by an equal allocator
+		const bool relink = static_cast<node_allocator&>(head) == static_cast<node_allocator&>(list_.head);
+		Link* first = nullptr;
+		Link** link = &first;
+		size_t n = 0;
+		try
+		{
+			while (list_.head.succ)
+			{
+				auto node = list_.head.succ;
+				if (relink && !list_._is_inline(node))
+				{
+					*link = node;
+					list_.head.succ = node->succ;
+				}
+				else
+				{
+					*link = _create_node(std::move(static_cast<Node*>(node)->data));
+					list_.head.succ = node->succ;
+					list_._destroy_node(node);
+				}
+				link = &(*link)->succ;
+				n++;
+			}
+		}
+		catch (...)
+		{
+			// the last link taken still points into list_
+			*link = nullptr;
+			list_.size_ -= n;
+			last->succ = first;
+			while (last->succ) last = last->succ;
+			size_ += n;
+			throw;
+		}
+		*link = nullptr;
+		list_.last = &list_.head;
+		list_.size_ = 0;
+		return first;
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	void small_forward_list<Elem, N, Alloc>::_relink(Link* first) noexcept
+	{
+		head.succ = first;
+		last = &head;
+		while (last->succ) last = last->succ;
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	small_forward_list<Elem, N, Alloc>::const_iterator::const_iterator(Link* node_) noexcept : node(node_) { }
+
+	template<typename Elem, size_t N, typename Alloc>
+	const Elem& small_forward_list<Elem, N, Alloc>::const_iterator::operator*() const
+	{
+#ifndef NDEBUG
+		if (!node) error_info("Dereference of end() of tvj::small_forward_list.", TVJ_FORWARD_LIST_NULLPTR);
+#endif
+		return static_cast<Node*>(node)->data;
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	const Elem* small_forward_list<Elem, N, Alloc>::const_iterator::operator->() const
+	{
+		return &**this;
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	typename small_forward_list<Elem, N, Alloc>::const_iterator& small_forward_list<Elem, N, Alloc>::const_iterator::operator++()
+	{
+#ifndef NDEBUG
+		if (!node) error_info("Increment of end() of tvj::small_forward_list.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		node = node->succ;
+		return *this;
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	typename small_forward_list<Elem, N, Alloc>::const_iterator small_forward_list<Elem, N, Alloc>::const_iterator::operator++(int)
+	{
+		auto ret = *this;
+		++*this;
+		return ret;
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	bool small_forward_list<Elem, N, Alloc>::const_iterator::operator==(const const_iterator& iter) const noexcept
+	{
+		return node == iter.node;
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	bool small_forward_list<Elem, N, Alloc>::const_iterator::operator!=(const const_iterator& iter) const noexcept
+	{
+		return node != iter.node;
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	Elem& small_forward_list<Elem, N, Alloc>::iterator::operator*() const
+	{
+		return const_cast<Elem&>(const_iterator::operator*());
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	Elem* small_forward_list<Elem, N, Alloc>::iterator::operator->() const
+	{
+		return &**this;
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	typename small_forward_list<Elem, N, Alloc>::iterator& small_forward_list<Elem, N, Alloc>::iterator::operator++()
+	{
+		const_iterator::operator++();
+		return *this;
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	typename small_forward_list<Elem, N, Alloc>::iterator small_forward_list<Elem, N, Alloc>::iterator::operator++(int)
+	{
+		auto ret = *this;
+		++*this;
+		return ret;
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	small_forward_list<Elem, N, Alloc>::small_forward_list() : head(node_allocator()), last(&head) { }
+
+	template<typename Elem, size_t N, typename Alloc>
+	small_forward_list<Elem, N, Alloc>::small_forward_list(const Alloc& alloc) : head(node_allocator(alloc)), last(&head) { }
+
+	template<typename Elem, size_t N, typename Alloc>
+	small_forward_list<Elem, N, Alloc>::small_forward_list(std::initializer_list<Elem> elems, const Alloc& alloc) : small_forward_list(alloc)
+	{
+		for (const auto& elem : elems) push_back(elem);
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	small_forward_list<Elem, N, Alloc>::small_forward_list(const small_forward_list& list_)
+		: head(node_traits::select_on_container_copy_construction(list_.head)), last(&head)
+	{
+		for (const auto& elem : list_) push_back(elem);
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	small_forward_list<Elem, N, Alloc>::small_forward_list(small_forward_list&& list_)
+		: head(static_cast<const node_allocator&>(list_.head)), last(&head)
+	{
+		const auto n = list_.size_;
+		try
+		{
+			_relink(_adopt(list_));
+		}
+		catch (...)
+		{
+			// the destructor is not called for a throwing constructor
+			clear();
+			throw;
+		}
+		size_ = n;
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	small_forward_list<Elem, N, Alloc>::~small_forward_list()
+	{
+		clear();
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	small_forward_list<Elem, N, Alloc>& small_forward_list<Elem, N, Alloc>::operator=(const small_forward_list& list_)
+	{
+		if (&list_ == this) return *this;
+		clear();
+		for (const auto& elem : list_) push_back(elem);
+		return *this;
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	small_forward_list<Elem, N, Alloc>& small_forward_list<Elem, N, Alloc>::operator=(small_forward_list&& list_)
+	{
+		if (&list_ == this) return *this;
+		clear();
+		const auto n = list_.size_;
+		_relink(_adopt(list_));
+		size_ = n;
+		return *this;
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	typename small_forward_list<Elem, N, Alloc>::allocator_type small_forward_list<Elem, N, Alloc>::get_allocator() const
+	{
+		return allocator_type(static_cast<const node_allocator&>(head));
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	constexpr size_t small_forward_list<Elem, N, Alloc>::inline_capacity() noexcept
+	{
+		return N;
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	void small_forward_list<Elem, N, Alloc>::clear() noexcept
+	{
+		while (head.succ)
+		{
+			auto node = head.succ;
+			head.succ = node->succ;
+			_destroy_node(node);
+		}
+		last = &head;
+		size_ = 0;
+		// all the inline slots are free again
+		inline_free = nullptr;
+		inline_used = 0;
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	size_t small_forward_list<Elem, N, Alloc>::size() const noexcept
+	{
+		return size_;
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	bool small_forward_list<Elem, N, Alloc>::empty() const noexcept
+	{
+		return !size_;
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	typename small_forward_list<Elem, N, Alloc>::iterator small_forward_list<Elem, N, Alloc>::before_begin() noexcept
+	{
+		return iterator(&head);
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	typename small_forward_list<Elem, N, Alloc>::iterator small_forward_list<Elem, N, Alloc>::begin() noexcept
+	{
+		return iterator(head.succ);
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	typename small_forward_list<Elem, N, Alloc>::iterator small_forward_list<Elem, N, Alloc>::back() noexcept
+	{
+		return iterator(size_ ? last : nullptr);
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	typename small_forward_list<Elem, N, Alloc>::iterator small_forward_list<Elem, N, Alloc>::end() noexcept
+	{
+		return iterator(nullptr);
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	typename small_forward_list<Elem, N, Alloc>::const_iterator small_forward_list<Elem, N, Alloc>::before_begin() const noexcept
+	{
+		return const_iterator(const_cast<Head*>(&head));
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	typename small_forward_list<Elem, N, Alloc>::const_iterator small_forward_list<Elem, N, Alloc>::begin() const noexcept
+	{
+		return const_iterator(head.succ);
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	typename small_forward_list<Elem, N, Alloc>::const_iterator small_forward_list<Elem, N, Alloc>::back() const noexcept
+	{
+		return const_iterator(size_ ? last : nullptr);
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	typename small_forward_list<Elem, N, Alloc>::const_iterator small_forward_list<Elem, N, Alloc>::end() const noexcept
+	{
+		return const_iterator(nullptr);
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	typename small_forward_list<Elem, N, Alloc>::iterator small_forward_list<Elem, N, Alloc>::find(const Elem& elem) noexcept
+	{
+		auto node = head.succ;
+		while (node && !(static_cast<Node*>(node)->data == elem)) node = node->succ;
+		return iterator(node);
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	typename small_forward_list<Elem, N, Alloc>::const_iterator small_forward_list<Elem, N, Alloc>::find(const Elem& elem) const noexcept
+	{
+		return const_cast<small_forward_list*>(this)->find(elem);
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	void small_forward_list<Elem, N, Alloc>::push_front(const Elem& elem)
+	{
+		insert_after(before_begin(), elem);
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	void small_forward_list<Elem, N, Alloc>::push_back(const Elem& elem)
+	{
+		insert_after(const_iterator(last), elem);
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	void small_forward_list<Elem, N, Alloc>::pop_front()
+	{
+#ifndef NDEBUG
+		if (empty()) error_info("Pop from an empty tvj::small_forward_list.", TVJ_FORWARD_LIST_UNDERFLOW);
+#endif
+		erase_after(before_begin());
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	typename small_forward_list<Elem, N, Alloc>::iterator small_forward_list<Elem, N, Alloc>::insert_after(const const_iterator& iter, const Elem& elem)
+	{
+#ifndef NDEBUG
+		if (!iter.node) error_info("Insert after end() of tvj::small_forward_list.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		Link* node = _create_node(elem);
+		node->succ = iter.node->succ;
+		iter.node->succ = node;
+		if (iter.node == last) last = node;
+		size_++;
+		return iterator(node);
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	typename small_forward_list<Elem, N, Alloc>::iterator small_forward_list<Elem, N, Alloc>::erase_after(const const_iterator& iter)
+	{
+#ifndef NDEBUG
+		if (!iter.node || iter.node == last) error_info("Erase after the last element of tvj::small_forward_list.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		auto node = iter.node->succ;
+		iter.node->succ = node->succ;
+		if (node == last) last = iter.node;
+		_destroy_node(node);
+		size_--;
+		return iterator(iter.node->succ);
+	}
+
+	template<typename Elem, size_t N, typename Alloc> template<typename Predicate>
+	size_t small_forward_list<Elem, N, Alloc>::remove_if(Predicate pred)
+	{
+		size_t removed = 0;
+		Link* prev = &head;
+		while (prev->succ)
+		{
+			auto node = prev->succ;
+			if (pred(static_cast<Node*>(node)->data))
+			{
+				// keep last and size_ valid in case pred throws later
+				prev->succ = node->succ;
+				if (node == last) last = prev;
+				_destroy_node(node);
+				size_--;
+				removed++;
+			}
+			else prev = node;
+		}
+		return removed;
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	void small_forward_list<Elem, N, Alloc>::unique()
+	{
+		if (size_ < 2) return;
+		Link* prev = head.succ;
+		while (prev->succ)
+		{
+			auto node = prev->succ;
+			if (static_cast<Node*>(node)->data == static_cast<Node*>(prev)->data)
+			{
+				prev->succ = node->succ;
+				if (node == last) last = prev;
+				_destroy_node(node);
+				size_--;
+			}
+			else prev = node;
+		}
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	void small_forward_list<Elem, N, Alloc>::sort(bool is_ascending)
+	{
+		if (size_ < 2) return;
+		Link* rest = head.succ;
+		_relink(_chain::sort(rest, size_, _order{ is_ascending }));
+	}
+
+	template<typename Elem, size_t N, typename Alloc>
+	void small_forward_list<Elem, N, Alloc>::merge(small_forward_list& list_, bool is_ascending)
+	{
+		if (&list_ == this) return;
+		const auto n = list_.size_;
+		auto other = _adopt(list_);
+		_relink(_chain::merge(head.succ, other, _order{ is_ascending }));
+		size_ += n;
+	}
+};
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
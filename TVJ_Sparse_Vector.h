@@ -0,0 +1,686 @@
+/*
+ * File: TVJ_Sparse_Vector.h
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include "TVJ_Forward_List.h"
+#include "TVJ_Node_Pool.h"
+
+namespace tvj
+{
+	// the nonzero entry of a tvj::sparse_vector
+	template<typename Index, typename Value>
+	struct sparse_entry
+	{
+		Index index;
+		Value value;
+	};
+
+	// The tvj::sparse_vector class
+	// that keeps the nonzero entries in a singly linked list sorted by ascending index.
+	// axpy, add and dot go through both lists once like merge, the nodes of the result are
+	// updated in place or relinked, and the entries becoming zero are dropped on the fly.
+	template<typename Value = double, typename Index = uint32_t, typename Alloc = std::allocator<sparse_entry<Index, Value>>>
+	class sparse_vector
+	{
+	public:
+		typedef sparse_entry<Index, Value> entry_type;
+		typedef Alloc                      allocator_type;
+
+	protected:
+		// the link of a node, the head sentinel is the link in the vector object
+		struct Link
+		{
+			Link* succ = nullptr;
+		};
+
+		// the class of the vector node
+		struct Node : Link
+		{
+			Node(Index index_, const Value& value_);
+			entry_type data;
+		};
+
+		typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node> node_allocator;
+		typedef std::allocator_traits<node_allocator> node_traits;
+
+		// the link before the entry with the smallest index, with the allocator for the entries
+		struct Head : node_allocator, Link
+		{
+			Head(const node_allocator& alloc);
+		};
+
+		// the entry of a link
+		static inline entry_type& _entry(Link* link) noexcept;
+
+		// allocate and construct a node with the allocator
+		Node* _create_node(Index index, const Value& value);
+
+		// destroy and deallocate a node with the allocator
+		void _destroy_node(Link* node) noexcept;
+
+		// destroy a nullptr-terminated chain of nodes
+		void _destroy_chain(Link* first) noexcept;
+
+		// the last link whose index is less than the index, searched from pos
+		static inline Link* _lower(Link* pos, Index index) noexcept;
+
+	private:
+		Head   head;
+		Link*  tail = &head; // the last node (&head if empty)
+		size_t size_ = 0;    // the number of nonzero entries
+
+	public:
+		class const_iterator
+		{
+			friend class sparse_vector<Value, Index, Alloc>;
+
+		protected:
+			Link* node;
+
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef entry_type                value_type;
+			typedef std::ptrdiff_t            difference_type;
+			typedef const entry_type*         pointer;
+			typedef const entry_type&         reference;
+
+			const_iterator(Link* node_ = nullptr) noexcept;
+		public:
+			inline const entry_type& operator*() const;
+			inline const entry_type* operator->() const;
+			inline const_iterator& operator++();
+			inline const_iterator operator++(int);
+			inline bool operator==(const const_iterator& iter) const noexcept;
+			inline bool operator!=(const const_iterator& iter) const noexcept;
+		};
+
+		/**
+		 * brief: constructor for zero vector
+		 * param: the allocator
+		 * return: --
+		 */
+		explicit sparse_vector(const Alloc& alloc = Alloc());
+
+		/**
+		 * brief: copy constructor (the allocator is selected by select_on_container_copy_construction)
+		 * param: another vector
+		 * return: --
+		 */
+		sparse_vector(const sparse_vector& vec);
+
+		/**
+		 * brief: move constructor (the allocator is moved with the nodes)
+		 * param: another vector
+		 * return: --
+		 */
+		sparse_vector(sparse_vector&& vec) noexcept;
+
+		/**
+		 * @brief: destructor
+		 * @param: (void)
+		 * @return: --
+		 */
+		~sparse_vector();
+
+		/**
+		 * brief: copy assignment (the allocator is kept)
+		 * param: another vector
+		 * return: sparse_vector&
+		 */
+		sparse_vector& operator=(const sparse_vector& vec);
+
+		/**
+		 * brief: move assignment, the nodes are taken if the allocators are equal,
+		 *        otherwise the entries are copied
+		 * param: another vector
+		 * return: sparse_vector&
+		 */
+		sparse_vector& operator=(sparse_vector&& vec);
+
+		/**
+		 * brief: exchange the nodes with another vector (the allocators must be equal)
+		 * param: another vector
+		 * return: void
+		 */
+		void swap(sparse_vector& vec) noexcept;
+
+		/**
+		 * brief: the allocator of the vector
+		 * param: (void)
+		 * return: allocator_type
+		 */
+		inline allocator_type get_allocator() const;
+
+		/**
+		 * brief: append an entry in O(1), its index must be larger than the last one (zero is ignored)
+		 * param: the index, the value
+		 * return: void
+		 */
+		void push_back(Index index, const Value& value);
+
+		/**
+		 * brief: set the value of an index in O(nnz), zero erases the entry
+		 * param: the index, the value
+		 * return: void
+		 */
+		void set(Index index, const Value& value);
+
+		/**
+		 * brief: the value of an index in O(nnz)
+		 * param: the index
+		 * return: Value (zero if not stored)
+		 */
+		Value get(Index index) const;
+
+		/**
+		 * brief: *this += a * x in one pass, new entries reuse the nodes dropped in the same pass
+		 * param: the scalar, the vector x
+		 * return: sparse_vector&
+		 */
+		sparse_vector& axpy(const Value& a, const sparse_vector& x);
+
+		/**
+		 * brief: *this += x in one pass
+		 * param: the vector x
+		 * return: sparse_vector&
+		 */
+		inline sparse_vector& add(const sparse_vector& x);
+
+		/**
+		 * brief: *this += x in one pass, the nodes of x are relinked if the allocators are equal
+		 *        (x is empty afterwards)
+		 * param: the vector x
+		 * return: sparse_vector&
+		 */
+		sparse_vector& add(sparse_vector&& x);
+
+		/**
+		 * brief: multiply all entries by a scalar
+		 * param: the scalar
+		 * return: sparse_vector&
+		 */
+		sparse_vector& scale(const Value& a);
+
+		/**
+		 * brief: the dot product in one pass (no allocation)
+		 * param: another vector
+		 * return: Value
+		 */
+		Value dot(const sparse_vector& x) const;
+
+		/**
+		 * brief: erase the entries whose absolute values are not larger than the tolerance
+		 * param: the tolerance
+		 * return: size_t (number of erased entries)
+		 */
+		size_t prune(const Value& tolerance = Value());
+
+		/**
+		 * brief: remove all entries
+		 * param: (void)
+		 * return: void
+		 */
+		void clear() noexcept;
+
+		/**
+		 * brief: the number of nonzero entries
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t size() const noexcept;
+
+		/**
+		 * brief: if the vector is zero
+		 * param: (void)
+		 * return: bool
+		 */
+		inline bool empty() const noexcept;
+
+		inline const_iterator begin() const noexcept;
+		inline const_iterator end() const noexcept;
+		inline const_iterator cbegin() const noexcept;
+		inline const_iterator cend() const noexcept;
+	};
+
+	// tvj::sparse_vector whose nodes come from a tvj::fixed_block_pool
+	template<typename Value = double, typename Index = uint32_t>
+	using pooled_sparse_vector = sparse_vector<Value, Index, pool_allocator<sparse_entry<Index, Value>>>;
+
+	template<typename Value, typename Index, typename Alloc>
+	sparse_vector<Value, Index, Alloc>::Node::Node(Index index_, const Value& value_) : data{ index_, value_ } { }
+
+	template<typename Value, typename Index, typename Alloc>
+	sparse_vector<Value, Index, Alloc>::Head::Head(const node_allocator& alloc) : node_allocator(alloc) { }
+
+	template<typename Value, typename Index, typename Alloc>
+	typename sparse_vector<Value, Index, Alloc>::entry_type& sparse_vector<Value, Index, Alloc>::_entry(Link* link) noexcept
+	{
+		return static_cast<Node*>(link)->data;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	typename sparse_vector<Value, Index, Alloc>::Node* sparse_vector<Value, Index, Alloc>::_create_node(Index index, const Value& value)
+	{
+		node_allocator& alloc = head;
+		Node* node = node_traits::allocate(alloc, 1);
+		try
+		{
+			node_traits::construct(alloc, node, index, value);
+		}
+		catch (...)
+		{
+			node_traits::deallocate(alloc, node, 1);
+			throw;
+		}
+		return node;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	void sparse_vector<Value, Index, Alloc>::_destroy_node(Link* node) noexcept
+	{
+		node_allocator& alloc = head;
+		auto node_ = static_cast<Node*>(node);
+		node_traits::destroy(alloc, node_);
+		node_traits::deallocate(alloc, node_, 1);
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	void sparse_vector<Value, Index, Alloc>::_destroy_chain(Link* first) noexcept
+	{
+		while (first)
+		{
+			auto node = first;
+			first = first->succ;
+			_destroy_node(node);
+		}
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	typename sparse_vector<Value, Index, Alloc>::Link* sparse_vector<Value, Index, Alloc>::_lower(Link* pos, Index index) noexcept
+	{
+		while (pos->succ && _entry(pos->succ).index < index) pos = pos->succ;
+		return pos;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	sparse_vector<Value, Index, Alloc>::const_iterator::const_iterator(Link* node_) noexcept : node(node_) { }
+
+	template<typename Value, typename Index, typename Alloc>
+	const typename sparse_vector<Value, Index, Alloc>::entry_type& sparse_vector<Value, Index, Alloc>::const_iterator::operator*() const
+	{
+#ifndef NDEBUG
+		if (!node) error_info("Dereference of end() of tvj::sparse_vector.", TVJ_FORWARD_LIST_NULLPTR);
+#endif
+		return _entry(node);
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	const typename sparse_vector<Value, Index, Alloc>::entry_type* sparse_vector<Value, Index, Alloc>::const_iterator::operator->() const
+	{
+		return &**this;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	typename sparse_vector<Value, Index, Alloc>::const_iterator& sparse_vector<Value, Index, Alloc>::const_iterator::operator++()
+	{
+#ifndef NDEBUG
+		if (!node) error_info("Increment of end() of tvj::sparse_vector.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		node = node->succ;
+		return *this;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	typename sparse_vector<Value, Index, Alloc>::const_iterator sparse_vector<Value, Index, Alloc>::const_iterator::operator++(int)
+	{
+		auto ret = *this;
+		++*this;
+		return ret;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	bool sparse_vector<Value, Index, Alloc>::const_iterator::operator==(const const_iterator& iter) const noexcept
+	{
+		return node == iter.node;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	bool sparse_vector<Value, Index, Alloc>::const_iterator::operator!=(const const_iterator& iter) const noexcept
+	{
+		return node != iter.node;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	sparse_vector<Value, Index, Alloc>::sparse_vector(const Alloc& alloc) : head(node_allocator(alloc)) { }
+
+	template<typename Value, typename Index, typename Alloc>
+	sparse_vector<Value, Index, Alloc>::sparse_vector(const sparse_vector& vec)
+		: head(node_traits::select_on_container_copy_construction(vec.head))
+	{
+		for (auto& e : vec) push_back(e.index, e.value);
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	sparse_vector<Value, Index, Alloc>::sparse_vector(sparse_vector&& vec) noexcept : head(std::move(static_cast<node_allocator&>(vec.head)))
+	{
+		swap(vec);
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	sparse_vector<Value, Index, Alloc>::~sparse_vector()
+	{
+		clear();
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	sparse_vector<Value, Index, Alloc>& sparse_vector<Value, Index, Alloc>::operator=(const sparse_vector& vec)
+	{
+		if (&vec == this) return *this;
+		clear();
+		for (auto& e : vec) push_back(e.index, e.value);
+		return *this;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	sparse_vector<Value, Index, Alloc>& sparse_vector<Value, Index, Alloc>::operator=(sparse_vector&& vec)
+	{
+		if (&vec == this) return *this;
+		clear();
+		if (static_cast<node_allocator&>(head) == static_cast<node_allocator&>(vec.head)) swap(vec);
+		else
+		{
+			for (auto& e : vec) push_back(e.index, e.value);
+			vec.clear();
+		}
+		return *this;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	void sparse_vector<Value, Index, Alloc>::swap(sparse_vector& vec) noexcept
+	{
+		std::swap(head.succ, vec.head.succ);
+		std::swap(size_, vec.size_);
+		// an empty vector has its tail at its own head
+		std::swap(tail, vec.tail);
+		if (!head.succ) tail = &head;
+		if (!vec.head.succ) vec.tail = &vec.head;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	typename sparse_vector<Value, Index, Alloc>::allocator_type sparse_vector<Value, Index, Alloc>::get_allocator() const
+	{
+		return allocator_type(static_cast<const node_allocator&>(head));
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	void sparse_vector<Value, Index, Alloc>::push_back(Index index, const Value& value)
+	{
+#ifndef NDEBUG
+		if (tail != &head && !(_entry(tail).index < index))
+			error_info("Index not larger than the last one in push_back of tvj::sparse_vector.", TVJ_FORWARD_LIST_ITER_RANGE);
+#endif
+		if (value == Value()) return;
+		tail = tail->succ = _create_node(index, value);
+		size_++;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	void sparse_vector<Value, Index, Alloc>::set(Index index, const Value& value)
+	{
+		auto pos = _lower(&head, index);
+		auto node = pos->succ;
+		if (node && !(index < _entry(node).index))
+		{
+			if (value != Value())
+			{
+				_entry(node).value = value;
+				return;
+			}
+			pos->succ = node->succ;
+			if (node == tail) tail = pos;
+			_destroy_node(node);
+			size_--;
+			return;
+		}
+		if (value == Value()) return;
+		node = _create_node(index, value);
+		node->succ = pos->succ;
+		pos->succ = node;
+		if (pos == tail) tail = node;
+		size_++;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	Value sparse_vector<Value, Index, Alloc>::get(Index index) const
+	{
+		auto node = _lower(const_cast<Head*>(&head), index)->succ;
+		return node && !(index < _entry(node).index) ? _entry(node).value : Value();
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	sparse_vector<Value, Index, Alloc>& sparse_vector<Value, Index, Alloc>::axpy(const Value& a, const sparse_vector& x)
+	{
+		if (&x == this) return scale(a + Value(1));
+		if (a == Value()) return *this;
+
+		Link* pos = &head;
+		Link* spare = nullptr; // the nodes dropped in this pass, reused before allocating
+		try
+		{
+			for (auto link = x.head.succ; link; link = link->succ)
+			{
+				const auto& e = _entry(link);
+				pos = _lower(pos, e.index);
+				auto node = pos->succ;
+				if (node && !(e.index < _entry(node).index))
+				{
+					auto& value = _entry(node).value;
+					value += a * e.value;
+					if (value != Value())
+					{
+						pos = node;
+						continue;
+					}
+					pos->succ = node->succ;
+					if (node == tail) tail = pos;
+					node->succ = spare;
+					spare = node;
+					size_--;
+					continue;
+				}
+				const Value value = a * e.value;
+				if (value == Value()) continue;
+				if (spare)
+				{
+					node = spare;
+					spare = spare->succ;
+					_entry(node) = entry_type{ e.index, value };
+				}
+				else node = _create_node(e.index, value);
+				node->succ = pos->succ;
+				pos->succ = node;
+				if (pos == tail) tail = node;
+				pos = node;
+				size_++;
+			}
+		}
+		catch (...)
+		{
+			_destroy_chain(spare);
+			throw;
+		}
+		_destroy_chain(spare);
+		return *this;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	sparse_vector<Value, Index, Alloc>& sparse_vector<Value, Index, Alloc>::add(const sparse_vector& x)
+	{
+		return axpy(Value(1), x);
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	sparse_vector<Value, Index, Alloc>& sparse_vector<Value, Index, Alloc>::add(sparse_vector&& x)
+	{
+		if (&x == this) return scale(Value(2));
+		if (static_cast<node_allocator&>(head) != static_cast<node_allocator&>(x.head))
+		{
+			axpy(Value(1), x);
+			x.clear();
+			return *this;
+		}
+
+		Link* pos = &head;
+		while (x.head.succ)
+		{
+			auto link = x.head.succ;
+			x.head.succ = link->succ;
+			x.size_--;
+			pos = _lower(pos, _entry(link).index);
+			auto node = pos->succ;
+			if (node && !(_entry(link).index < _entry(node).index))
+			{
+				auto& value = _entry(node).value;
+				value += _entry(link).value;
+				_destroy_node(link);
+				if (value != Value())
+				{
+					pos = node;
+					continue;
+				}
+				pos->succ = node->succ;
+				if (node == tail) tail = pos;
+				_destroy_node(node);
+				size_--;
+				continue;
+			}
+			// relink the node of x
+			link->succ = pos->succ;
+			pos->succ = link;
+			if (pos == tail) tail = link;
+			pos = link;
+			size_++;
+		}
+		x.tail = &x.head;
+		return *this;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	sparse_vector<Value, Index, Alloc>& sparse_vector<Value, Index, Alloc>::scale(const Value& a)
+	{
+		if (a == Value())
+		{
+			clear();
+			return *this;
+		}
+		for (auto link = head.succ; link; link = link->succ) _entry(link).value *= a;
+		return *this;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	Value sparse_vector<Value, Index, Alloc>::dot(const sparse_vector& x) const
+	{
+		Value sum = Value();
+		auto p = head.succ, q = x.head.succ;
+		while (p && q)
+		{
+			const auto& e = _entry(p), & f = _entry(q);
+			if (e.index < f.index)      p = p->succ;
+			else if (f.index < e.index) q = q->succ;
+			else
+			{
+				sum += e.value * f.value;
+				p = p->succ;
+				q = q->succ;
+			}
+		}
+		return sum;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	size_t sparse_vector<Value, Index, Alloc>::prune(const Value& tolerance)
+	{
+		size_t erased = 0;
+		Link* pos = &head;
+		while (pos->succ)
+		{
+			auto node = pos->succ;
+			const auto& value = _entry(node).value;
+			if (value < -tolerance || tolerance < value)
+			{
+				pos = node;
+				continue;
+			}
+			pos->succ = node->succ;
+			_destroy_node(node);
+			erased++;
+		}
+		tail = pos;
+		size_ -= erased;
+		return erased;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	void sparse_vector<Value, Index, Alloc>::clear() noexcept
+	{
+		_destroy_chain(head.succ);
+		head.succ = nullptr;
+		tail = &head;
+		size_ = 0;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	size_t sparse_vector<Value, Index, Alloc>::size() const noexcept
+	{
+		return size_;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	bool sparse_vector<Value, Index, Alloc>::empty() const noexcept
+	{
+		return !size_;
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	typename sparse_vector<Value, Index, Alloc>::const_iterator sparse_vector<Value, Index, Alloc>::begin() const noexcept
+	{
+		return const_iterator(head.succ);
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	typename sparse_vector<Value, Index, Alloc>::const_iterator sparse_vector<Value, Index, Alloc>::end() const noexcept
+	{
+		return const_iterator(nullptr);
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	typename sparse_vector<Value, Index, Alloc>::const_iterator sparse_vector<Value, Index, Alloc>::cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	template<typename Value, typename Index, typename Alloc>
+	typename sparse_vector<Value, Index, Alloc>::const_iterator sparse_vector<Value, Index, Alloc>::cend() const noexcept
+	{
+		return end();
+	}
+};
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
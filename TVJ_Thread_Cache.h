@@ -0,0 +1,331 @@
+/*
+ * File: TVJ_Thread_Cache.h
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <thread>
+#include "TVJ_Forward_List.h"
+
+namespace tvj
+{
+	// The per-thread cache of free blocks of one size (the node size),
+	// it holds two magazines and exchanges whole magazines with a global depot.
+	template<size_t Size, size_t Align>
+	class node_cache
+	{
+		static_assert(Align <= alignof(std::max_align_t), "tvj::node_cache does not support over-aligned blocks.");
+
+	protected:
+		// a free block, connected by succ (nullptr-terminated in a magazine)
+		struct Block
+		{
+			Block* succ;
+			Block* next; // the first block of the next magazine in the depot (only set in the first block)
+		};
+
+		// a chain of free blocks
+		struct Magazine
+		{
+			Block* first = nullptr;
+			size_t count = 0;
+		};
+
+		static constexpr size_t block_size    = ((Size < sizeof(Block) ? sizeof(Block) : Size) + Align - 1) / Align * Align;
+		static constexpr size_t magazine_size = 64;
+
+		// The depot shared by all threads, magazines are moved in and out of it as a whole.
+		// They are stacked through the first blocks, so giving one back cannot fail,
+		// and the lock only guards a few pointer writes, so it is a spin lock.
+		class Depot
+		{
+		private:
+			std::atomic_flag busy = ATOMIC_FLAG_INIT;
+			Block* magazines = nullptr; // the first block of the top magazine
+
+			inline void _lock() noexcept;
+			inline void _unlock() noexcept;
+
+		public:
+			// take a magazine, a new slab is carved if there is none
+			Magazine pop();
+
+			// give back a magazine (it can be partly filled)
+			void push(const Magazine& magazine) noexcept;
+		};
+
+		// the depot is never destroyed (the slabs are never freed),
+		// so lists destroyed after the cache of their thread can still release nodes
+		static Depot& _depot() noexcept;
+
+		// whether the cache of the current thread is destroyed,
+		// it is a trivially destructible thread_local so it can still be read after that
+		static inline bool& _destroyed() noexcept;
+
+		// the cache of the current thread, nullptr once it is destroyed at the thread exit
+		static node_cache* _local() noexcept;
+
+		// take a block from this cache
+		inline void* _pop();
+
+		// put a block into this cache
+		inline void _push(void* ptr) noexcept;
+
+	private:
+		Magazine loaded;   // the magazine used by allocate and deallocate
+		Magazine previous; // the full or empty one swapped with loaded
+
+		node_cache() = default;
+
+	public:
+		node_cache(const node_cache&) = delete;
+		node_cache& operator=(const node_cache&) = delete;
+
+		/**
+		 * @brief: destructor, the blocks are returned to the depot when the thread exits
+		 * @param: (void)
+		 * @return: --
+		 */
+		~node_cache();
+
+		/**
+		 * brief: take a block from the cache of the current thread
+		 *        (from ::operator new once that cache is destroyed)
+		 * param: (void)
+		 * return: void*
+		 */
+		static inline void* allocate();
+
+		/**
+		 * brief: put a block into the cache of the current thread (it may be allocated by another thread),
+		 *        or into the depot once that cache is destroyed
+		 * param: the block
+		 * return: void
+		 */
+		static inline void deallocate(void* ptr) noexcept;
+	};
+
+	// The stateless allocator using tvj::node_cache for single objects,
+	// allocations of more than one object go to ::operator new.
+	template<typename T>
+	class thread_cache_allocator
+	{
+	public:
+		typedef T value_type;
+		typedef std::true_type is_always_equal;
+
+		template<typename U>
+		struct rebind
+		{
+			typedef thread_cache_allocator<U> other;
+		};
+
+		thread_cache_allocator() noexcept = default;
+
+		template<typename U>
+		thread_cache_allocator(const thread_cache_allocator<U>& alloc) noexcept;
+
+		/**
+		 * brief: allocate n objects
+		 * param: the number of objects
+		 * return: T*
+		 */
+		inline T* allocate(size_t n);
+
+		/**
+		 * brief: deallocate n objects
+		 * param: the pointer, the number of objects
+		 * return: void
+		 */
+		inline void deallocate(T* ptr, size_t n) noexcept;
+
+		template<typename U>
+		inline bool operator==(const thread_cache_allocator<U>& alloc) const noexcept;
+		template<typename U>
+		inline bool operator!=(const thread_cache_allocator<U>& alloc) const noexcept;
+	};
+
+	// tvj::forward_list whose nodes come from the thread caches
+	template<typename Elem>
+	using thread_cache_forward_list = forward_list<Elem, thread_cache_allocator<Elem>>;
+
+	template<size_t Size, size_t Align>
+	void node_cache<Size, Align>::Depot::_lock() noexcept
+	{
+		while (busy.test_and_set(std::memory_order_acquire)) std::this_thread::yield();
+	}
+
+	template<size_t Size, size_t Align>
+	void node_cache<Size, Align>::Depot::_unlock() noexcept
+	{
+		busy.clear(std::memory_order_release);
+	}
+
+	template<size_t Size, size_t Align>
+	typename node_cache<Size, Align>::Magazine node_cache<Size, Align>::Depot::pop()
+	{
+		_lock();
+		auto first = magazines;
+		if (first) magazines = first->next;
+		_unlock();
+		if (first)
+		{
+			// count the blocks outside the lock (at most magazine_size)
+			Magazine magazine;
+			magazine.first = first;
+			for (auto block = first; block; block = block->succ) magazine.count++;
+			return magazine;
+		}
+		// carve a new slab
+		auto slab = static_cast<unsigned char*>(::operator new(block_size * magazine_size));
+		Magazine magazine;
+		for (size_t i = magazine_size; i != 0; i--)
+		{
+			auto block = reinterpret_cast<Block*>(slab + (i - 1) * block_size);
+			block->succ = magazine.first;
+			magazine.first = block;
+		}
+		magazine.count = magazine_size;
+		return magazine;
+	}
+
+	template<size_t Size, size_t Align>
+	void node_cache<Size, Align>::Depot::push(const Magazine& magazine) noexcept
+	{
+		if (!magazine.count) return;
+		_lock();
+		magazine.first->next = magazines;
+		magazines = magazine.first;
+		_unlock();
+	}
+
+	template<size_t Size, size_t Align>
+	typename node_cache<Size, Align>::Depot& node_cache<Size, Align>::_depot() noexcept
+	{
+		// trivially destructible, so it outlives every thread_local and static list
+		static Depot depot;
+		return depot;
+	}
+
+	template<size_t Size, size_t Align>
+	bool& node_cache<Size, Align>::_destroyed() noexcept
+	{
+		thread_local bool destroyed = false;
+		return destroyed;
+	}
+
+	template<size_t Size, size_t Align>
+	node_cache<Size, Align>* node_cache<Size, Align>::_local() noexcept
+	{
+		if (_destroyed()) return nullptr;
+		thread_local node_cache cache;
+		return &cache;
+	}
+
+	template<size_t Size, size_t Align>
+	node_cache<Size, Align>::~node_cache()
+	{
+		_destroyed() = true;
+		_depot().push(loaded);
+		_depot().push(previous);
+	}
+
+	template<size_t Size, size_t Align>
+	void* node_cache<Size, Align>::allocate()
+	{
+		auto cache = _local();
+		if (cache) return cache->_pop();
+		// the blocks are never freed to ::operator delete, so they can join the depot later
+		return ::operator new(block_size);
+	}
+
+	template<size_t Size, size_t Align>
+	void node_cache<Size, Align>::deallocate(void* ptr) noexcept
+	{
+		auto cache = _local();
+		if (cache)
+		{
+			cache->_push(ptr);
+			return;
+		}
+		Magazine magazine;
+		magazine.first = static_cast<Block*>(ptr);
+		magazine.first->succ = nullptr;
+		magazine.count = 1;
+		_depot().push(magazine);
+	}
+
+	template<size_t Size, size_t Align>
+	void* node_cache<Size, Align>::_pop()
+	{
+		if (!loaded.count)
+		{
+			if (previous.count) std::swap(loaded, previous);
+			else                loaded = _depot().pop();
+		}
+		auto block = loaded.first;
+		loaded.first = block->succ;
+		loaded.count--;
+		return block;
+	}
+
+	template<size_t Size, size_t Align>
+	void node_cache<Size, Align>::_push(void* ptr) noexcept
+	{
+		if (loaded.count == magazine_size)
+		{
+			// previous is either empty or full, a full one goes to the depot
+			if (previous.count) _depot().push(previous);
+			previous = loaded;
+			loaded = Magazine();
+		}
+		auto block = static_cast<Block*>(ptr);
+		block->succ = loaded.first;
+		loaded.first = block;
+		loaded.count++;
+	}
+
+	template<typename T> template<typename U>
+	thread_cache_allocator<T>::thread_cache_allocator(const thread_cache_allocator<U>&) noexcept { }
+
+	template<typename T>
+	T* thread_cache_allocator<T>::allocate(size_t n)
+	{
+		if (n == 1) return static_cast<T*>(node_cache<sizeof(T), alignof(T)>::allocate());
+		return static_cast<T*>(::operator new(n * sizeof(T)));
+	}
+
+	template<typename T>
+	void thread_cache_allocator<T>::deallocate(T* ptr, size_t n) noexcept
+	{
+		if (n == 1) node_cache<sizeof(T), alignof(T)>::deallocate(ptr);
+		else        ::operator delete(ptr);
+	}
+
+	template<typename T> template<typename U>
+	bool thread_cache_allocator<T>::operator==(const thread_cache_allocator<U>&) const noexcept
+	{
+		return true;
+	}
+
+	template<typename T> template<typename U>
+	bool thread_cache_allocator<T>::operator!=(const thread_cache_allocator<U>&) const noexcept
+	{
+		return false;
+	}
+};
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
@@ -0,0 +1,327 @@
+/*
+ * File: TVJ_Timer_Wheel.h
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <utility>
+#include "TVJ_Node_Pool.h"
+
+namespace tvj
+{
+	// The hierarchical timer wheel with Levels levels of 2^Bits slots,
+	// each slot is a singly linked chain of timer nodes drawn from a tvj::fixed_block_pool.
+	// A tick takes the whole chain of the expired slot at once, and the chains of higher levels
+	// are cascaded to lower ones by relinking their nodes (no allocation or copy).
+	// Cancelling a timer only marks its node, which is released when its slot is reached.
+	template<typename Elem = std::function<void()>, unsigned Bits = 8, unsigned Levels = 4>
+	class timer_wheel
+	{
+		static_assert(Bits > 0 && Levels > 0 && Bits * Levels < 64, "Invalid size of tvj::timer_wheel.");
+
+	protected:
+		// the class of the timer node
+		struct Node
+		{
+			template<typename... Args>
+			Node(uint64_t expiry_, uint64_t id_, Args&&... args);
+			Node*    succ = nullptr;
+			uint64_t expiry; // the tick when it expires
+			uint64_t id;     // 0 if it is cancelled or fired
+			Elem     data;   // the data the timer contains
+		};
+
+		static constexpr size_t   slots = size_t(1) << Bits;
+		static constexpr uint64_t mask  = slots - 1;
+
+		// link the node into the slot of its expiry
+		void _place(Node* node) noexcept;
+
+		// relink the nodes of a slot of a level to lower ones
+		void _cascade(unsigned level) noexcept;
+
+		// destroy a node and return it to the pool
+		void _destroy_node(Node* node) noexcept;
+
+	private:
+		fixed_block_pool pool;
+		Node*    wheel[Levels][slots] = {};
+		uint64_t now_    = 0;
+		uint64_t next_id = 1;
+		size_t   size_   = 0; // the timers scheduled and not cancelled
+
+	public:
+		// The handle of a scheduled timer, it stays safe to use after the timer fires.
+		class handle
+		{
+			friend class timer_wheel<Elem, Bits, Levels>;
+
+		protected:
+			Node*    node = nullptr;
+			uint64_t id   = 0;
+
+		public:
+			handle() = default;
+		};
+
+		/**
+		 * brief: constructor
+		 * param: the number of timers in a chunk of the pool
+		 * return: --
+		 */
+		explicit timer_wheel(size_t chunk_timers = 1024);
+
+		timer_wheel(const timer_wheel&) = delete;
+		timer_wheel& operator=(const timer_wheel&) = delete;
+
+		/**
+		 * @brief: destructor, the timers not fired are destroyed
+		 * @param: (void)
+		 * @return: --
+		 */
+		~timer_wheel();
+
+		/**
+		 * brief: schedule a timer in O(1), it expires after at least one tick
+		 * param: the delay in ticks, the arguments of the element constructor
+		 * return: handle
+		 */
+		template<typename... Args>
+		handle schedule(uint64_t delay, Args&&... args);
+
+		/**
+		 * brief: cancel a timer in O(1) (its node is released when its slot is reached)
+		 * param: the handle
+		 * return: bool (false if it has fired or been cancelled)
+		 */
+		bool cancel(const handle& timer) noexcept;
+
+		/**
+		 * brief: whether the timer is still scheduled
+		 * param: the handle
+		 * return: bool
+		 */
+		inline bool pending(const handle& timer) const noexcept;
+
+		/**
+		 * brief: move the time forward, the expired timers are passed to the function in the order of ticks
+		 * param: the number of ticks, the function called with Elem&
+		 * return: size_t (number of fired timers)
+		 */
+		template<typename Function>
+		size_t advance(uint64_t ticks, Function fn);
+
+		/**
+		 * brief: move the time forward and call the expired timers (Elem must be callable)
+		 * param: the number of ticks
+		 * return: size_t (number of fired timers)
+		 */
+		inline size_t advance(uint64_t ticks);
+
+		/**
+		 * brief: the current tick
+		 * param: (void)
+		 * return: uint64_t
+		 */
+		inline uint64_t now() const noexcept;
+
+		/**
+		 * brief: the number of timers scheduled
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t size() const noexcept;
+
+		/**
+		 * brief: if there is no timer scheduled
+		 * param: (void)
+		 * return: bool
+		 */
+		inline bool empty() const noexcept;
+	};
+
+	template<typename Elem, unsigned Bits, unsigned Levels> template<typename... Args>
+	timer_wheel<Elem, Bits, Levels>::Node::Node(uint64_t expiry_, uint64_t id_, Args&&... args) : expiry(expiry_), id(id_), data(std::forward<Args>(args)...) { }
+
+	template<typename Elem, unsigned Bits, unsigned Levels>
+	void timer_wheel<Elem, Bits, Levels>::_place(Node* node) noexcept
+	{
+		const uint64_t delay = node->expiry - now_;
+		unsigned level = 0;
+		while (level + 1 != Levels && delay >> ((level + 1) * Bits)) level++;
+		// timers beyond the top level wait in its farthest slot and are placed again when it is cascaded
+		uint64_t expiry = node->expiry;
+		if (delay >> (Levels * Bits)) expiry = now_ + (uint64_t(1) << (Levels * Bits)) - 1;
+		auto& slot = wheel[level][(expiry >> (level * Bits)) & mask];
+		node->succ = slot;
+		slot = node;
+	}
+
+	template<typename Elem, unsigned Bits, unsigned Levels>
+	void timer_wheel<Elem, Bits, Levels>::_cascade(unsigned level) noexcept
+	{
+		auto& slot = wheel[level][(now_ >> (level * Bits)) & mask];
+		auto node = slot;
+		slot = nullptr;
+		while (node)
+		{
+			auto next = node->succ;
+			if (node->id) _place(node);
+			else          _destroy_node(node);
+			node = next;
+		}
+	}
+
+	template<typename Elem, unsigned Bits, unsigned Levels>
+	void timer_wheel<Elem, Bits, Levels>::_destroy_node(Node* node) noexcept
+	{
+		node->~Node();
+		pool.deallocate(node);
+	}
+
+	template<typename Elem, unsigned Bits, unsigned Levels>
+	timer_wheel<Elem, Bits, Levels>::timer_wheel(size_t chunk_timers) : pool(chunk_timers) { }
+
+	template<typename Elem, unsigned Bits, unsigned Levels>
+	timer_wheel<Elem, Bits, Levels>::~timer_wheel()
+	{
+		for (auto& level : wheel)
+		{
+			for (auto node : level)
+			{
+				while (node)
+				{
+					auto next = node->succ;
+					_destroy_node(node);
+					node = next;
+				}
+			}
+		}
+	}
+
+	template<typename Elem, unsigned Bits, unsigned Levels> template<typename... Args>
+	typename timer_wheel<Elem, Bits, Levels>::handle timer_wheel<Elem, Bits, Levels>::schedule(uint64_t delay, Args&&... args)
+	{
+		if (!delay) delay = 1;
+		void* ptr = pool.allocate(sizeof(Node), alignof(Node));
+		Node* node;
+		try
+		{
+			node = ::new (ptr) Node(now_ + delay, next_id++, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			pool.deallocate(ptr);
+			throw;
+		}
+		_place(node);
+		size_++;
+		handle timer;
+		timer.node = node;
+		timer.id = node->id;
+		return timer;
+	}
+
+	template<typename Elem, unsigned Bits, unsigned Levels>
+	bool timer_wheel<Elem, Bits, Levels>::cancel(const handle& timer) noexcept
+	{
+		if (!pending(timer)) return false;
+		timer.node->id = 0;
+		size_--;
+		return true;
+	}
+
+	template<typename Elem, unsigned Bits, unsigned Levels>
+	bool timer_wheel<Elem, Bits, Levels>::pending(const handle& timer) const noexcept
+	{
+		// the node memory stays in the pool, a recycled node has another id
+		return timer.node && timer.id && timer.node->id == timer.id;
+	}
+
+	template<typename Elem, unsigned Bits, unsigned Levels> template<typename Function>
+	size_t timer_wheel<Elem, Bits, Levels>::advance(uint64_t ticks, Function fn)
+	{
+		size_t fired = 0;
+		for (; ticks; ticks--)
+		{
+			now_++;
+			// cascade the levels whose lower levels have wrapped around
+			for (unsigned level = 1; level != Levels && !(now_ & ((uint64_t(1) << (level * Bits)) - 1)); level++) _cascade(level);
+
+			auto& slot = wheel[0][now_ & mask];
+			auto node = slot;
+			slot = nullptr;
+			while (node)
+			{
+				auto next = node->succ;
+				if (node->id)
+				{
+					node->id = 0;
+					size_--;
+					fired++;
+					try
+					{
+						fn(node->data);
+					}
+					catch (...)
+					{
+						// the timers not yet fired go back to the slot which is processed again by the next advance
+						_destroy_node(node);
+						while (next)
+						{
+							node = next;
+							next = node->succ;
+							node->succ = slot;
+							slot = node;
+						}
+						now_--;
+						throw;
+					}
+				}
+				_destroy_node(node);
+				node = next;
+			}
+		}
+		return fired;
+	}
+
+	template<typename Elem, unsigned Bits, unsigned Levels>
+	size_t timer_wheel<Elem, Bits, Levels>::advance(uint64_t ticks)
+	{
+		return advance(ticks, [](Elem& elem) { elem(); });
+	}
+
+	template<typename Elem, unsigned Bits, unsigned Levels>
+	uint64_t timer_wheel<Elem, Bits, Levels>::now() const noexcept
+	{
+		return now_;
+	}
+
+	template<typename Elem, unsigned Bits, unsigned Levels>
+	size_t timer_wheel<Elem, Bits, Levels>::size() const noexcept
+	{
+		return size_;
+	}
+
+	template<typename Elem, unsigned Bits, unsigned Levels>
+	bool timer_wheel<Elem, Bits, Levels>::empty() const noexcept
+	{
+		return !size_;
+	}
+};
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
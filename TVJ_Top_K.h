@@ -0,0 +1,574 @@
+/*
+ * File: TVJ_Top_K.h
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "TVJ_Forward_List.h"
+
+namespace tvj
+{
+	// The tvj::top_k class
+	// that keeps the K greatest elements by Compare seen in a stream,
+	// as a singly linked chain sorted from the least (the threshold to enter) to the greatest.
+	// The K nodes live in the object: when it is full, an element not greater than the least one is rejected
+	// by one comparison, otherwise the node of the least one is reused for it.
+	template<typename Elem, size_t K, typename Compare = std::less<Elem>>
+	class top_k
+	{
+		static_assert(K > 0, "Zero size of tvj::top_k.");
+
+	protected:
+		// the link of a node (the head sentinel only has the link)
+		struct Link
+		{
+			Link* succ = nullptr;
+		};
+
+		// the class of the chain node
+		struct Node : Link
+		{
+			template<typename... Args>
+			Node(Args&&... args);
+			Elem data; // the data the node contains
+		};
+
+		// a free slot, connected by succ
+		struct Block
+		{
+			Block* succ;
+		};
+
+		// the element of a link
+		static inline const Elem& _data(const Link* link) noexcept;
+
+		// construct a node in a free slot (there must be one)
+		template<typename... Args>
+		Node* _create_node(Args&&... args);
+
+		// destroy a node and free its slot
+		void _destroy_node(Link* node) noexcept;
+
+		// link a node at its sorted position (after the equal ones),
+		// Compare is only called before anything is changed
+		void _insert(Link* node);
+
+		// link a node at the end (it must not be less than the greatest one)
+		inline void _append(Link* node) noexcept;
+
+		// set tail to the last node
+		void _fix_tail() noexcept;
+
+		// the result of merge_all of no trackers, which needs a default constructed Compare
+		static inline top_k _merge_none(std::true_type);
+		static inline top_k _merge_none(std::false_type);
+
+	private:
+		typename std::aligned_storage<sizeof(Node), alignof(Node)>::type slots[K];
+		Link    head;            // before the least element
+		Link*   tail  = &head;   // the greatest element (&head if empty)
+		Block*  free_ = nullptr; // the slots freed
+		size_t  fresh = 0;       // the slots never used are [fresh, K)
+		size_t  size_ = 0;
+		Compare comp;
+
+	public:
+		class const_iterator
+		{
+			friend class top_k<Elem, K, Compare>;
+
+		protected:
+			const Link* node;
+
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef Elem                      value_type;
+			typedef std::ptrdiff_t            difference_type;
+			typedef const Elem*               pointer;
+			typedef const Elem&               reference;
+
+			const_iterator(const Link* node_ = nullptr) noexcept;
+		public:
+			inline const Elem& operator*() const;
+			inline const Elem* operator->() const;
+			inline const_iterator& operator++();
+			inline const_iterator operator++(int);
+			inline bool operator==(const const_iterator& iter) const noexcept;
+			inline bool operator!=(const const_iterator& iter) const noexcept;
+		};
+
+		/**
+		 * brief: constructor for empty tracker
+		 * param: the comparison
+		 * return: --
+		 */
+		explicit top_k(const Compare& comp_ = Compare());
+
+		/**
+		 * brief: copy constructor
+		 * param: another tracker
+		 * return: --
+		 */
+		top_k(const top_k& tracker);
+
+		/**
+		 * @brief: destructor
+		 * @param: (void)
+		 * @return: --
+		 */
+		~top_k();
+
+		/**
+		 * brief: copy assignment
+		 * param: another tracker
+		 * return: top_k&
+		 */
+		top_k& operator=(const top_k& tracker);
+
+		/**
+		 * brief: offer an element, O(1) if rejected and O(K) if kept
+		 * param: the element
+		 * return: bool (whether it is kept)
+		 */
+		template<typename E>
+		bool push(E&& elem);
+
+		/**
+		 * brief: merge the elements of another tracker, keeping the K greatest of both in O(K)
+		 * param: another tracker
+		 * return: void
+		 */
+		void merge(const top_k& tracker);
+
+		/**
+		 * brief: the K greatest elements of the trackers (e.g. one per thread) by a k-way merge,
+		 *        the result uses the Compare of the first tracker (std::underflow_error is thrown
+		 *        for an empty range if Compare is not default constructible)
+		 * param: the first and last iterator of the trackers
+		 * return: top_k
+		 */
+		template<typename _Iter>
+		static top_k merge_all(_Iter first, const _Iter& last);
+
+		/**
+		 * brief: the least element kept (the threshold to enter when it is full)
+		 * param: (void)
+		 * return: const Elem&
+		 */
+		inline const Elem& min() const;
+
+		/**
+		 * brief: the greatest element kept
+		 * param: (void)
+		 * return: const Elem&
+		 */
+		inline const Elem& max() const;
+
+		/**
+		 * brief: remove all elements
+		 * param: (void)
+		 * return: void
+		 */
+		void clear() noexcept;
+
+		/**
+		 * brief: the number of elements kept
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t size() const noexcept;
+
+		/**
+		 * brief: if there is no element
+		 * param: (void)
+		 * return: bool
+		 */
+		inline bool empty() const noexcept;
+
+		/**
+		 * brief: if it holds K elements
+		 * param: (void)
+		 * return: bool
+		 */
+		inline bool full() const noexcept;
+
+		// iterate from the least to the greatest
+		inline const_iterator begin() const noexcept;
+		inline const_iterator end() const noexcept;
+		inline const_iterator cbegin() const noexcept;
+		inline const_iterator cend() const noexcept;
+	};
+
+	template<typename Elem, size_t K, typename Compare> template<typename... Args>
+	top_k<Elem, K, Compare>::Node::Node(Args&&... args) : data(std::forward<Args>(args)...) { }
+
+	template<typename Elem, size_t K, typename Compare>
+	const Elem& top_k<Elem, K, Compare>::_data(const Link* link) noexcept
+	{
+		return static_cast<const Node*>(link)->data;
+	}
+
+	template<typename Elem, size_t K, typename Compare> template<typename... Args>
+	typename top_k<Elem, K, Compare>::Node* top_k<Elem, K, Compare>::_create_node(Args&&... args)
+	{
+		void* slot;
+		Block* next = nullptr;
+		if (free_)
+		{
+			slot = free_;
+			next = free_->succ;
+		}
+		else slot = &slots[fresh];
+		try
+		{
+			auto node = ::new (slot) Node(std::forward<Args>(args)...);
+			if (free_) free_ = next;
+			else       fresh++;
+			return node;
+		}
+		catch (...)
+		{
+			if (free_) ::new (slot) Block{ next };
+			throw;
+		}
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	void top_k<Elem, K, Compare>::_destroy_node(Link* node) noexcept
+	{
+		auto node_ = static_cast<Node*>(node);
+		node_->~Node();
+		free_ = ::new (static_cast<void*>(node_)) Block{ free_ };
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	void top_k<Elem, K, Compare>::_insert(Link* node)
+	{
+		Link* pos = &head;
+		while (pos->succ && !comp(_data(node), _data(pos->succ))) pos = pos->succ;
+		node->succ = pos->succ;
+		pos->succ = node;
+		if (pos == tail) tail = node;
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	void top_k<Elem, K, Compare>::_append(Link* node) noexcept
+	{
+		node->succ = nullptr;
+		tail->succ = node;
+		tail = node;
+		size_++;
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	void top_k<Elem, K, Compare>::_fix_tail() noexcept
+	{
+		tail = &head;
+		while (tail->succ) tail = tail->succ;
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	top_k<Elem, K, Compare> top_k<Elem, K, Compare>::_merge_none(std::true_type)
+	{
+		return top_k();
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	top_k<Elem, K, Compare> top_k<Elem, K, Compare>::_merge_none(std::false_type)
+	{
+		throw std::underflow_error("Merge of no tvj::top_k whose Compare is not default constructible.");
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	top_k<Elem, K, Compare>::const_iterator::const_iterator(const Link* node_) noexcept : node(node_) { }
+
+	template<typename Elem, size_t K, typename Compare>
+	const Elem& top_k<Elem, K, Compare>::const_iterator::operator*() const
+	{
+#ifndef NDEBUG
+		if (!node) error_info("Dereference of end() of tvj::top_k.", TVJ_FORWARD_LIST_NULLPTR);
+#endif
+		return _data(node);
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	const Elem* top_k<Elem, K, Compare>::const_iterator::operator->() const
+	{
+		return &**this;
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	typename top_k<Elem, K, Compare>::const_iterator& top_k<Elem, K, Compare>::const_iterator::operator++()
+	{
+#ifndef NDEBUG
+		if (!node) error_info("Increment of end() of tvj::top_k.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		node = node->succ;
+		return *this;
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	typename top_k<Elem, K, Compare>::const_iterator top_k<Elem, K, Compare>::const_iterator::operator++(int)
+	{
+		auto ret = *this;
+		++*this;
+		return ret;
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	bool top_k<Elem, K, Compare>::const_iterator::operator==(const const_iterator& iter) const noexcept
+	{
+		return node == iter.node;
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	bool top_k<Elem, K, Compare>::const_iterator::operator!=(const const_iterator& iter) const noexcept
+	{
+		return node != iter.node;
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	top_k<Elem, K, Compare>::top_k(const Compare& comp_) : comp(comp_) { }
+
+	template<typename Elem, size_t K, typename Compare>
+	top_k<Elem, K, Compare>::top_k(const top_k& tracker) : comp(tracker.comp)
+	{
+		try
+		{
+			for (auto& elem : tracker) _append(_create_node(elem));
+		}
+		catch (...)
+		{
+			clear();
+			throw;
+		}
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	top_k<Elem, K, Compare>::~top_k()
+	{
+		clear();
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	top_k<Elem, K, Compare>& top_k<Elem, K, Compare>::operator=(const top_k& tracker)
+	{
+		if (&tracker == this) return *this;
+		clear();
+		comp = tracker.comp;
+		for (auto& elem : tracker) _append(_create_node(elem));
+		return *this;
+	}
+
+	template<typename Elem, size_t K, typename Compare> template<typename E>
+	bool top_k<Elem, K, Compare>::push(E&& elem)
+	{
+		if (size_ != K)
+		{
+			auto node = _create_node(std::forward<E>(elem));
+			try
+			{
+				_insert(node);
+			}
+			catch (...)
+			{
+				_destroy_node(node);
+				throw;
+			}
+			size_++;
+			return true;
+		}
+		if (!comp(_data(head.succ), elem)) return false;
+
+		// reuse the node of the least element
+		auto node = head.succ;
+		head.succ = node->succ;
+		if (node == tail) tail = &head;
+		try
+		{
+			static_cast<Node*>(node)->data = std::forward<E>(elem);
+			_insert(node);
+		}
+		catch (...)
+		{
+			_destroy_node(node);
+			size_--;
+			throw;
+		}
+		return true;
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	void top_k<Elem, K, Compare>::merge(const top_k& tracker)
+	{
+		if (&tracker == this)
+		{
+			merge(top_k(tracker));
+			return;
+		}
+
+		// drop the least elements of both beyond K, they are prefixes of both chains
+		const size_t total = size_ + tracker.size_;
+		size_t skip = total > K ? total - K : 0;
+		const Link* other = tracker.head.succ;
+		for (; skip; skip--)
+		{
+			auto node = head.succ;
+			if (node && (!other || !comp(_data(other), _data(node))))
+			{
+				head.succ = node->succ;
+				_destroy_node(node);
+				size_--;
+			}
+			else other = other->succ;
+		}
+
+		// copy the rest of the other chain into the freed slots, merging in one pass
+		Link* pos = &head;
+		try
+		{
+			for (; other; other = other->succ)
+			{
+				while (pos->succ && !comp(_data(other), _data(pos->succ))) pos = pos->succ;
+				auto node = _create_node(_data(other));
+				node->succ = pos->succ;
+				pos->succ = node;
+				pos = node;
+				size_++;
+			}
+		}
+		catch (...)
+		{
+			_fix_tail();
+			throw;
+		}
+		_fix_tail();
+	}
+
+	template<typename Elem, size_t K, typename Compare> template<typename _Iter>
+	top_k<Elem, K, Compare> top_k<Elem, K, Compare>::merge_all(_Iter first, const _Iter& last)
+	{
+		if (first == last) return _merge_none(std::is_default_constructible<Compare>());
+		top_k result(first->comp);
+
+		// the cursors form a min heap on their current elements
+		std::vector<const Link*> cursors;
+		size_t total = 0;
+		for (; first != last; ++first)
+		{
+			total += first->size_;
+			if (first->head.succ) cursors.push_back(first->head.succ);
+		}
+		const Compare& comp_ = result.comp;
+		auto greater = [&comp_](const Link* a, const Link* b) { return comp_(_data(b), _data(a)); };
+		std::make_heap(cursors.begin(), cursors.end(), greater);
+
+		// the elements come in ascending order, only the last K are kept
+		size_t skip = total > K ? total - K : 0;
+		while (!cursors.empty())
+		{
+			std::pop_heap(cursors.begin(), cursors.end(), greater);
+			auto& cursor = cursors.back();
+			if (skip) skip--;
+			else      result._append(result._create_node(_data(cursor)));
+			if ((cursor = cursor->succ)) std::push_heap(cursors.begin(), cursors.end(), greater);
+			else                         cursors.pop_back();
+		}
+		return result;
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	const Elem& top_k<Elem, K, Compare>::min() const
+	{
+#ifndef NDEBUG
+		if (!size_) error_info("Min of an empty tvj::top_k.", TVJ_FORWARD_LIST_UNDERFLOW);
+#endif
+		return _data(head.succ);
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	const Elem& top_k<Elem, K, Compare>::max() const
+	{
+#ifndef NDEBUG
+		if (!size_) error_info("Max of an empty tvj::top_k.", TVJ_FORWARD_LIST_UNDERFLOW);
+#endif
+		return _data(tail);
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	void top_k<Elem, K, Compare>::clear() noexcept
+	{
+		while (head.succ)
+		{
+			auto node = static_cast<Node*>(head.succ);
+			head.succ = node->succ;
+			node->~Node();
+		}
+		tail = &head;
+		free_ = nullptr;
+		fresh = 0;
+		size_ = 0;
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	size_t top_k<Elem, K, Compare>::size() const noexcept
+	{
+		return size_;
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	bool top_k<Elem, K, Compare>::empty() const noexcept
+	{
+		return !size_;
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	bool top_k<Elem, K, Compare>::full() const noexcept
+	{
+		return size_ == K;
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	typename top_k<Elem, K, Compare>::const_iterator top_k<Elem, K, Compare>::begin() const noexcept
+	{
+		return const_iterator(head.succ);
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	typename top_k<Elem, K, Compare>::const_iterator top_k<Elem, K, Compare>::end() const noexcept
+	{
+		return const_iterator(nullptr);
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	typename top_k<Elem, K, Compare>::const_iterator top_k<Elem, K, Compare>::cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	template<typename Elem, size_t K, typename Compare>
+	typename top_k<Elem, K, Compare>::const_iterator top_k<Elem, K, Compare>::cend() const noexcept
+	{
+		return end();
+	}
+};
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry
@@ -0,0 +1,944 @@
+/*
+ * File: TVJ_Unordered_Map.h
+ * Project: TVJ_Forward_List
+ * --------------------------
+ *
+ * @author: Teddy van Jerry
+ * @licence: The MIT Licence
+ * @compiler: at least C++/14
+ *
+ * @version 1.0 2026/10/18
+ * - initial version
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "TVJ_Node_Pool.h"
+
+namespace tvj
+{
+	// The chained hash table used by tvj::unordered_map and tvj::unordered_set.
+	// The buckets are singly linked chains of nodes which cache the hash values,
+	// the nodes come from a tvj::fixed_block_pool owned by the table,
+	// and the number of buckets is a power of 2 indexed by Fibonacci hashing.
+	// Growing the table is incremental: the old buckets are moved to the new ones
+	// a few at a time by relinking their nodes on later insertions.
+	// Insertions may invalidate iterators (not references), erasure only invalidates the erased one.
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	class hash_table
+	{
+	protected:
+		// the class of the table node
+		struct Node
+		{
+			template<typename... Args>
+			Node(size_t hash_, Args&&... args);
+			Node*  succ = nullptr;
+			size_t hash;  // the cached hash value
+			Value  value; // the data the node contains
+		};
+
+		static constexpr size_t min_buckets  = 8;
+		static constexpr size_t rehash_step  = 4;    // the old buckets moved by each insertion
+		static constexpr size_t pool_chunk   = 1024; // the nodes in a chunk of the pool
+
+		// the bucket index of a hash value with 2^bits buckets
+		static inline size_t _index(size_t hash, unsigned bits) noexcept;
+
+		// allocate and construct a node from the pool
+		template<typename... Args>
+		Node* _create_node(size_t hash, Args&&... args);
+
+		// destroy a node and return it to the pool
+		void _destroy_node(Node* node) noexcept;
+
+		// the link pointing to the node with the key (or to nullptr if not found)
+		Node** _find_link(const Key& key, size_t hash) const;
+
+		// the node with the key (nullptr if not found, or if the table has no buckets)
+		inline Node* _find(const Key& key, size_t hash) const;
+
+		// move some old buckets (all if n is 0) to the new ones
+		void _migrate(size_t n) noexcept;
+
+		// start growing to 2^bits buckets (finishing the previous growth first)
+		void _grow(unsigned bits);
+
+		// insert a node that is not in the table, growing it if needed
+		Node* _insert_node(Node* node);
+
+		// the bucket of the iterator where the node is (new buckets followed by the old ones)
+		inline size_t _bucket_of(const Node* node) const noexcept;
+
+	private:
+		std::unique_ptr<fixed_block_pool> pool;
+		std::vector<Node*> buckets;     // 2^bits buckets
+		std::vector<Node*> old_buckets; // 2^old_bits buckets being moved (empty if not growing)
+		unsigned bits = 0;
+		unsigned old_bits = 0;
+		size_t   migrated = 0;          // the old buckets already moved
+		size_t   size_ = 0;
+		float    max_load = 1.0f;
+		Hash     hasher;
+		KeyEqual key_equal;
+
+	public:
+		typedef Key    key_type;
+		typedef Value  value_type;
+		typedef Hash   hasher_type;
+		typedef KeyEqual key_equal_type;
+
+		class const_iterator
+		{
+			template<typename, typename, typename, typename, typename> friend class hash_table;
+
+		protected:
+			const hash_table* table;
+			size_t bucket; // the index of new buckets followed by the old ones
+			Node*  node;
+
+			// move to the first node from the bucket on
+			void _settle() noexcept;
+
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef Value                     value_type;
+			typedef std::ptrdiff_t            difference_type;
+			typedef const Value*              pointer;
+			typedef const Value&              reference;
+
+			const_iterator(const hash_table* table_ = nullptr, size_t bucket_ = 0, Node* node_ = nullptr) noexcept;
+		public:
+			inline const Value& operator*() const;
+			inline const Value* operator->() const;
+			inline const_iterator& operator++();
+			inline const_iterator operator++(int);
+			inline bool operator==(const const_iterator& iter) const noexcept;
+			inline bool operator!=(const const_iterator& iter) const noexcept;
+		};
+
+		class mutable_iterator : public const_iterator
+		{
+		public:
+			typedef Value* pointer;
+			typedef Value& reference;
+
+			// constructor declaration
+			using const_iterator::const_iterator;
+			inline Value& operator*() const;
+			inline Value* operator->() const;
+			inline mutable_iterator& operator++();
+			inline mutable_iterator operator++(int);
+		};
+
+		// the elements of a set are the keys themselves, so they are never handed out mutable
+		typedef typename std::conditional<std::is_same<Key, Value>::value, const_iterator, mutable_iterator>::type iterator;
+
+		/**
+		 * brief: constructor
+		 * param: the initial number of buckets, the hash function, the key equality
+		 * return: --
+		 */
+		explicit hash_table(size_t bucket_count = min_buckets, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual());
+
+		/**
+		 * brief: copy constructor (the nodes are drawn from a new pool)
+		 * param: another table
+		 * return: --
+		 */
+		hash_table(const hash_table& table_);
+
+		/**
+		 * brief: move constructor, the pool and the buckets are taken
+		 *        (table_ allocates new ones on its next insertion)
+		 * param: another table
+		 * return: --
+		 */
+		hash_table(hash_table&& table_) noexcept(std::is_nothrow_copy_constructible<Hash>::value && std::is_nothrow_copy_constructible<KeyEqual>::value);
+
+		/**
+		 * @brief: destructor
+		 * @param: (void)
+		 * @return: --
+		 */
+		~hash_table();
+
+		/**
+		 * brief: copy assignment
+		 * param: another table
+		 * return: hash_table&
+		 */
+		hash_table& operator=(const hash_table& table_);
+
+		/**
+		 * brief: move assignment
+		 * param: another table
+		 * return: hash_table&
+		 */
+		hash_table& operator=(hash_table&& table_) noexcept;
+
+		/**
+		 * brief: exchange the elements with another table
+		 * param: another table
+		 * return: void
+		 */
+		void swap(hash_table& table_) noexcept;
+
+		/**
+		 * brief: the number of elements
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t size() const noexcept;
+
+		/**
+		 * brief: if the table is empty
+		 * param: (void)
+		 * return: bool
+		 */
+		inline bool empty() const noexcept;
+
+		/**
+		 * brief: remove all elements, the nodes stay in the pool for reuse
+		 * param: (void)
+		 * return: void
+		 */
+		void clear() noexcept;
+
+		/**
+		 * brief: the iterator begin()
+		 * param: (void)
+		 * return: iterator
+		 */
+		inline iterator begin() noexcept;
+
+		/**
+		 * brief: the iterator end()
+		 * param: (void)
+		 * return: iterator
+		 */
+		inline iterator end() noexcept;
+
+		/**
+		 * brief: the iterator begin()
+		 * param: (void)
+		 * return: const_iterator
+		 */
+		inline const_iterator begin() const noexcept;
+
+		/**
+		 * brief: the iterator end()
+		 * param: (void)
+		 * return: const_iterator
+		 */
+		inline const_iterator end() const noexcept;
+
+		/**
+		 * brief: find the element with the key, if no result found, return end()
+		 * param: the key
+		 * return: iterator
+		 */
+		iterator find(const Key& key);
+
+		/**
+		 * brief: find the element with the key, if no result found, return end()
+		 * param: the key
+		 * return: const_iterator
+		 */
+		const_iterator find(const Key& key) const;
+
+		/**
+		 * brief: count the elements with the key (0 or 1)
+		 * param: the key
+		 * return: size_t
+		 */
+		inline size_t count(const Key& key) const;
+
+		/**
+		 * brief: check whether the table contains the key
+		 * param: the key
+		 * return: bool
+		 */
+		inline bool contains(const Key& key) const;
+
+		/**
+		 * brief: insert the element if its key is not in the table
+		 * param: the element
+		 * return: std::pair<iterator, bool> (the element with the key, whether it is inserted)
+		 */
+		std::pair<iterator, bool> insert(const Value& value);
+
+		/**
+		 * brief: construct the element and insert it if its key is not in the table
+		 * param: the arguments of the element constructor
+		 * return: std::pair<iterator, bool> (the element with the key, whether it is inserted)
+		 */
+		template<typename... Args>
+		std::pair<iterator, bool> emplace(Args&&... args);
+
+		/**
+		 * brief: erase the element with the key
+		 * param: the key
+		 * return: size_t (number of erased elements)
+		 */
+		size_t erase(const Key& key);
+
+		/**
+		 * brief: erase the element of the iterator
+		 * param: the iterator
+		 * return: iterator (the next element)
+		 */
+		iterator erase(const const_iterator& iter);
+
+		/**
+		 * brief: the number of buckets (the new ones while growing)
+		 * param: (void)
+		 * return: size_t
+		 */
+		inline size_t bucket_count() const noexcept;
+
+		/**
+		 * brief: whether the old buckets are still being moved
+		 * param: (void)
+		 * return: bool
+		 */
+		inline bool rehashing() const noexcept;
+
+		/**
+		 * brief: the average number of elements per bucket
+		 * param: (void)
+		 * return: float
+		 */
+		inline float load_factor() const noexcept;
+
+		/**
+		 * brief: the load factor that triggers growing
+		 * param: (void)
+		 * return: float
+		 */
+		inline float max_load_factor() const noexcept;
+
+		/**
+		 * brief: set the load factor that triggers growing
+		 * param: the load factor
+		 * return: void
+		 */
+		inline void max_load_factor(float load) noexcept;
+
+		/**
+		 * brief: rehash to at least n buckets at once by relinking the nodes
+		 * param: the number of buckets
+		 * return: void
+		 */
+		void rehash(size_t n);
+
+		/**
+		 * brief: make room for n elements without growing
+		 * param: the number of elements
+		 * return: void
+		 */
+		inline void reserve(size_t n);
+
+		/**
+		 * brief: the statistics of the node pool
+		 * param: (void)
+		 * return: fixed_block_pool::Stats
+		 */
+		inline fixed_block_pool::Stats pool_stats() const noexcept;
+	};
+
+	// the key of an element of tvj::unordered_map
+	struct _select_first
+	{
+		template<typename Pair>
+		inline const typename Pair::first_type& operator()(const Pair& pair) const noexcept
+		{
+			return pair.first;
+		}
+	};
+
+	// the key of an element of tvj::unordered_set
+	struct _identity
+	{
+		template<typename T>
+		inline const T& operator()(const T& value) const noexcept
+		{
+			return value;
+		}
+	};
+
+	// The tvj::unordered_map class
+	// that maps unique keys to values in a tvj::hash_table.
+	template<typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+	class unordered_map : public hash_table<Key, std::pair<const Key, T>, _select_first, Hash, KeyEqual>
+	{
+		typedef hash_table<Key, std::pair<const Key, T>, _select_first, Hash, KeyEqual> base;
+
+	public:
+		typedef T mapped_type;
+
+		using base::base;
+
+		/**
+		 * brief: the value of the key, it is inserted (value-initialized) if not found
+		 * param: the key
+		 * return: T&
+		 */
+		inline T& operator[](const Key& key);
+
+		/**
+		 * brief: the value of the key, std::out_of_range is thrown if not found
+		 * param: the key
+		 * return: T&
+		 */
+		inline T& at(const Key& key);
+
+		/**
+		 * brief: the value of the key, std::out_of_range is thrown if not found
+		 * param: the key
+		 * return: const T&
+		 */
+		inline const T& at(const Key& key) const;
+	};
+
+	// The tvj::unordered_set class
+	// that stores unique keys in a tvj::hash_table,
+	// its iterator is the const_iterator like std::unordered_set.
+	template<typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+	class unordered_set : public hash_table<Key, Key, _identity, Hash, KeyEqual>
+	{
+		typedef hash_table<Key, Key, _identity, Hash, KeyEqual> base;
+
+	public:
+		using base::base;
+	};
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual> template<typename... Args>
+	hash_table<Key, Value, KeyOf, Hash, KeyEqual>::Node::Node(size_t hash_, Args&&... args) : hash(hash_), value(std::forward<Args>(args)...) { }
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	size_t hash_table<Key, Value, KeyOf, Hash, KeyEqual>::_index(size_t hash, unsigned bits) noexcept
+	{
+		// Fibonacci hashing spreads weak hashes (like the identity of integers) over the high bits
+		return static_cast<size_t>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> (64 - bits));
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual> template<typename... Args>
+	typename hash_table<Key, Value, KeyOf, Hash, KeyEqual>::Node* hash_table<Key, Value, KeyOf, Hash, KeyEqual>::_create_node(size_t hash, Args&&... args)
+	{
+		// a moved-from table gets a new pool on its next insertion
+		if (!pool) pool.reset(new fixed_block_pool(pool_chunk));
+		void* ptr = pool->allocate(sizeof(Node), alignof(Node));
+		try
+		{
+			return ::new (ptr) Node(hash, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			pool->deallocate(ptr);
+			throw;
+		}
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	void hash_table<Key, Value, KeyOf, Hash, KeyEqual>::_destroy_node(Node* node) noexcept
+	{
+		node->~Node();
+		pool->deallocate(node);
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	typename hash_table<Key, Value, KeyOf, Hash, KeyEqual>::Node** hash_table<Key, Value, KeyOf, Hash, KeyEqual>::_find_link(const Key& key, size_t hash) const
+	{
+		// the key is in its old bucket if that bucket has not been moved
+		auto& table = const_cast<hash_table&>(*this);
+		Node** link;
+		if (!old_buckets.empty() && _index(hash, old_bits) >= migrated) link = &table.old_buckets[_index(hash, old_bits)];
+		else link = &table.buckets[_index(hash, bits)];
+		while (*link && !((*link)->hash == hash && key_equal(KeyOf()((*link)->value), key))) link = &(*link)->succ;
+		return link;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	typename hash_table<Key, Value, KeyOf, Hash, KeyEqual>::Node* hash_table<Key, Value, KeyOf, Hash, KeyEqual>::_find(const Key& key, size_t hash) const
+	{
+		return size_ ? *_find_link(key, hash) : nullptr;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	void hash_table<Key, Value, KeyOf, Hash, KeyEqual>::_migrate(size_t n) noexcept
+	{
+		if (old_buckets.empty()) return;
+		const size_t last = n && migrated + n < old_buckets.size() ? migrated + n : old_buckets.size();
+		for (; migrated != last; migrated++)
+		{
+			auto node = old_buckets[migrated];
+			while (node)
+			{
+				auto next = node->succ;
+				auto& bucket = buckets[_index(node->hash, bits)];
+				node->succ = bucket;
+				bucket = node;
+				node = next;
+			}
+			old_buckets[migrated] = nullptr;
+		}
+		if (migrated == old_buckets.size())
+		{
+			std::vector<Node*>().swap(old_buckets);
+			migrated = 0;
+		}
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	void hash_table<Key, Value, KeyOf, Hash, KeyEqual>::_grow(unsigned bits_)
+	{
+		_migrate(0);
+		std::vector<Node*> new_buckets(size_t(1) << bits_, nullptr);
+		old_buckets.swap(buckets);
+		buckets.swap(new_buckets);
+		old_bits = bits;
+		bits = bits_;
+		migrated = 0;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	typename hash_table<Key, Value, KeyOf, Hash, KeyEqual>::Node* hash_table<Key, Value, KeyOf, Hash, KeyEqual>::_insert_node(Node* node)
+	{
+		if (static_cast<float>(size_ + 1) > max_load * static_cast<float>(buckets.size()))
+		{
+			try
+			{
+				// a moved-from table without buckets starts again from the minimum
+				_grow(buckets.empty() ? 3 : bits + 1);
+			}
+			catch (...)
+			{
+				_destroy_node(node);
+				throw;
+			}
+		}
+		_migrate(rehash_step);
+		// the node goes to its old bucket if that bucket has not been moved, where it is looked up
+		auto& bucket = !old_buckets.empty() && _index(node->hash, old_bits) >= migrated ?
+			old_buckets[_index(node->hash, old_bits)] : buckets[_index(node->hash, bits)];
+		node->succ = bucket;
+		bucket = node;
+		size_++;
+		return node;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	size_t hash_table<Key, Value, KeyOf, Hash, KeyEqual>::_bucket_of(const Node* node) const noexcept
+	{
+		if (!old_buckets.empty() && _index(node->hash, old_bits) >= migrated) return buckets.size() + _index(node->hash, old_bits);
+		return _index(node->hash, bits);
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	hash_table<Key, Value, KeyOf, Hash, KeyEqual>::const_iterator::const_iterator(const hash_table* table_, size_t bucket_, Node* node_) noexcept
+		: table(table_), bucket(bucket_), node(node_) { }
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	void hash_table<Key, Value, KeyOf, Hash, KeyEqual>::const_iterator::_settle() noexcept
+	{
+		const size_t n = table->buckets.size();
+		const size_t total = n + table->old_buckets.size();
+		while (!node && bucket < total)
+		{
+			node = bucket < n ? table->buckets[bucket] : table->old_buckets[bucket - n];
+			if (!node) bucket++;
+		}
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	const Value& hash_table<Key, Value, KeyOf, Hash, KeyEqual>::const_iterator::operator*() const
+	{
+#ifndef NDEBUG
+		if (!node) error_info("Dereference of end() of tvj::hash_table.", TVJ_FORWARD_LIST_NULLPTR);
+#endif
+		return node->value;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	const Value* hash_table<Key, Value, KeyOf, Hash, KeyEqual>::const_iterator::operator->() const
+	{
+		return &**this;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	typename hash_table<Key, Value, KeyOf, Hash, KeyEqual>::const_iterator& hash_table<Key, Value, KeyOf, Hash, KeyEqual>::const_iterator::operator++()
+	{
+#ifndef NDEBUG
+		if (!node) error_info("Increment of end() of tvj::hash_table.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		node = node->succ;
+		if (!node)
+		{
+			bucket++;
+			_settle();
+		}
+		return *this;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	typename hash_table<Key, Value, KeyOf, Hash, KeyEqual>::const_iterator hash_table<Key, Value, KeyOf, Hash, KeyEqual>::const_iterator::operator++(int)
+	{
+		auto ret = *this;
+		++*this;
+		return ret;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	bool hash_table<Key, Value, KeyOf, Hash, KeyEqual>::const_iterator::operator==(const const_iterator& iter) const noexcept
+	{
+		return node == iter.node;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	bool hash_table<Key, Value, KeyOf, Hash, KeyEqual>::const_iterator::operator!=(const const_iterator& iter) const noexcept
+	{
+		return node != iter.node;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	Value& hash_table<Key, Value, KeyOf, Hash, KeyEqual>::mutable_iterator::operator*() const
+	{
+		return const_cast<Value&>(const_iterator::operator*());
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	Value* hash_table<Key, Value, KeyOf, Hash, KeyEqual>::mutable_iterator::operator->() const
+	{
+		return &**this;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	typename hash_table<Key, Value, KeyOf, Hash, KeyEqual>::mutable_iterator& hash_table<Key, Value, KeyOf, Hash, KeyEqual>::mutable_iterator::operator++()
+	{
+		const_iterator::operator++();
+		return *this;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	typename hash_table<Key, Value, KeyOf, Hash, KeyEqual>::mutable_iterator hash_table<Key, Value, KeyOf, Hash, KeyEqual>::mutable_iterator::operator++(int)
+	{
+		auto ret = *this;
+		++*this;
+		return ret;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	hash_table<Key, Value, KeyOf, Hash, KeyEqual>::hash_table(size_t bucket_count, const Hash& hash, const KeyEqual& equal)
+		: pool(new fixed_block_pool(pool_chunk)), hasher(hash), key_equal(equal)
+	{
+		bits = 3;
+		while ((size_t(1) << bits) < bucket_count) bits++;
+		buckets.assign(size_t(1) << bits, nullptr);
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	hash_table<Key, Value, KeyOf, Hash, KeyEqual>::hash_table(const hash_table& table_)
+		: hash_table(static_cast<size_t>(static_cast<float>(table_.size_) / table_.max_load) + 1, table_.hasher, table_.key_equal)
+	{
+		max_load = table_.max_load;
+		for (const auto& value : table_) _insert_node(_create_node(hasher(KeyOf()(value)), value));
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	hash_table<Key, Value, KeyOf, Hash, KeyEqual>::hash_table(hash_table&& table_) noexcept(std::is_nothrow_copy_constructible<Hash>::value && std::is_nothrow_copy_constructible<KeyEqual>::value)
+		: pool(std::move(table_.pool)), buckets(std::move(table_.buckets)), old_buckets(std::move(table_.old_buckets)),
+		  bits(table_.bits), old_bits(table_.old_bits), migrated(table_.migrated), size_(table_.size_), max_load(table_.max_load),
+		  hasher(table_.hasher), key_equal(table_.key_equal)
+	{
+		// table_ keeps its functions and has neither pool nor buckets
+		table_.buckets.clear();
+		table_.old_buckets.clear();
+		table_.bits = table_.old_bits = 0;
+		table_.migrated = 0;
+		table_.size_ = 0;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	hash_table<Key, Value, KeyOf, Hash, KeyEqual>::~hash_table()
+	{
+		clear();
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	hash_table<Key, Value, KeyOf, Hash, KeyEqual>& hash_table<Key, Value, KeyOf, Hash, KeyEqual>::operator=(const hash_table& table_)
+	{
+		if (&table_ == this) return *this;
+		hash_table copy(table_);
+		swap(copy);
+		return *this;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	hash_table<Key, Value, KeyOf, Hash, KeyEqual>& hash_table<Key, Value, KeyOf, Hash, KeyEqual>::operator=(hash_table&& table_) noexcept
+	{
+		if (&table_ == this) return *this;
+		swap(table_);
+		return *this;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	void hash_table<Key, Value, KeyOf, Hash, KeyEqual>::swap(hash_table& table_) noexcept
+	{
+		using std::swap;
+		swap(pool, table_.pool);
+		buckets.swap(table_.buckets);
+		old_buckets.swap(table_.old_buckets);
+		swap(bits, table_.bits);
+		swap(old_bits, table_.old_bits);
+		swap(migrated, table_.migrated);
+		swap(size_, table_.size_);
+		swap(max_load, table_.max_load);
+		swap(hasher, table_.hasher);
+		swap(key_equal, table_.key_equal);
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	size_t hash_table<Key, Value, KeyOf, Hash, KeyEqual>::size() const noexcept
+	{
+		return size_;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	bool hash_table<Key, Value, KeyOf, Hash, KeyEqual>::empty() const noexcept
+	{
+		return !size_;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	void hash_table<Key, Value, KeyOf, Hash, KeyEqual>::clear() noexcept
+	{
+		for (auto table : { &buckets, &old_buckets })
+		{
+			for (auto& bucket : *table)
+			{
+				while (bucket)
+				{
+					auto node = bucket;
+					bucket = node->succ;
+					_destroy_node(node);
+				}
+			}
+		}
+		std::vector<Node*>().swap(old_buckets);
+		migrated = 0;
+		size_ = 0;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	typename hash_table<Key, Value, KeyOf, Hash, KeyEqual>::iterator hash_table<Key, Value, KeyOf, Hash, KeyEqual>::begin() noexcept
+	{
+		iterator iter(this, 0, nullptr);
+		iter._settle();
+		return iter;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	typename hash_table<Key, Value, KeyOf, Hash, KeyEqual>::iterator hash_table<Key, Value, KeyOf, Hash, KeyEqual>::end() noexcept
+	{
+		return iterator(this, buckets.size() + old_buckets.size(), nullptr);
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	typename hash_table<Key, Value, KeyOf, Hash, KeyEqual>::const_iterator hash_table<Key, Value, KeyOf, Hash, KeyEqual>::begin() const noexcept
+	{
+		return const_cast<hash_table*>(this)->begin();
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	typename hash_table<Key, Value, KeyOf, Hash, KeyEqual>::const_iterator hash_table<Key, Value, KeyOf, Hash, KeyEqual>::end() const noexcept
+	{
+		return const_cast<hash_table*>(this)->end();
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	typename hash_table<Key, Value, KeyOf, Hash, KeyEqual>::iterator hash_table<Key, Value, KeyOf, Hash, KeyEqual>::find(const Key& key)
+	{
+		auto node = _find(key, hasher(key));
+		if (!node) return end();
+		return iterator(this, _bucket_of(node), node);
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	typename hash_table<Key, Value, KeyOf, Hash, KeyEqual>::const_iterator hash_table<Key, Value, KeyOf, Hash, KeyEqual>::find(const Key& key) const
+	{
+		return const_cast<hash_table*>(this)->find(key);
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	size_t hash_table<Key, Value, KeyOf, Hash, KeyEqual>::count(const Key& key) const
+	{
+		return _find(key, hasher(key)) ? 1 : 0;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	bool hash_table<Key, Value, KeyOf, Hash, KeyEqual>::contains(const Key& key) const
+	{
+		return _find(key, hasher(key)) != nullptr;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	std::pair<typename hash_table<Key, Value, KeyOf, Hash, KeyEqual>::iterator, bool> hash_table<Key, Value, KeyOf, Hash, KeyEqual>::insert(const Value& value)
+	{
+		const auto& key = KeyOf()(value);
+		const size_t hash = hasher(key);
+		if (auto node = _find(key, hash)) return std::make_pair(iterator(this, _bucket_of(node), node), false);
+		auto node = _insert_node(_create_node(hash, value));
+		return std::make_pair(iterator(this, _bucket_of(node), node), true);
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual> template<typename... Args>
+	std::pair<typename hash_table<Key, Value, KeyOf, Hash, KeyEqual>::iterator, bool> hash_table<Key, Value, KeyOf, Hash, KeyEqual>::emplace(Args&&... args)
+	{
+		// the element is constructed first to get its key, and released if the key exists
+		auto node = _create_node(0, std::forward<Args>(args)...);
+		const auto& key = KeyOf()(node->value);
+		try
+		{
+			node->hash = hasher(key);
+		}
+		catch (...)
+		{
+			_destroy_node(node);
+			throw;
+		}
+		if (auto found = _find(key, node->hash))
+		{
+			_destroy_node(node);
+			return std::make_pair(iterator(this, _bucket_of(found), found), false);
+		}
+		_insert_node(node);
+		return std::make_pair(iterator(this, _bucket_of(node), node), true);
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	size_t hash_table<Key, Value, KeyOf, Hash, KeyEqual>::erase(const Key& key)
+	{
+		if (!size_) return 0;
+		auto link = _find_link(key, hasher(key));
+		auto node = *link;
+		if (!node) return 0;
+		*link = node->succ;
+		_destroy_node(node);
+		size_--;
+		return 1;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	typename hash_table<Key, Value, KeyOf, Hash, KeyEqual>::iterator hash_table<Key, Value, KeyOf, Hash, KeyEqual>::erase(const const_iterator& iter)
+	{
+#ifndef NDEBUG
+		if (!iter.node) error_info("Erase end() of tvj::hash_table.", TVJ_FORWARD_LIST_OVERFLOW);
+#endif
+		iterator next(this, iter.bucket, iter.node);
+		++next;
+		const size_t n = buckets.size();
+		auto link = iter.bucket < n ? &buckets[iter.bucket] : &old_buckets[iter.bucket - n];
+		while (*link != iter.node) link = &(*link)->succ;
+		*link = iter.node->succ;
+		_destroy_node(iter.node);
+		size_--;
+		return next;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	size_t hash_table<Key, Value, KeyOf, Hash, KeyEqual>::bucket_count() const noexcept
+	{
+		return buckets.size();
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	bool hash_table<Key, Value, KeyOf, Hash, KeyEqual>::rehashing() const noexcept
+	{
+		return !old_buckets.empty();
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	float hash_table<Key, Value, KeyOf, Hash, KeyEqual>::load_factor() const noexcept
+	{
+		if (buckets.empty()) return 0.0f;
+		return static_cast<float>(size_) / static_cast<float>(buckets.size());
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	float hash_table<Key, Value, KeyOf, Hash, KeyEqual>::max_load_factor() const noexcept
+	{
+		return max_load;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	void hash_table<Key, Value, KeyOf, Hash, KeyEqual>::max_load_factor(float load) noexcept
+	{
+		max_load = load;
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	void hash_table<Key, Value, KeyOf, Hash, KeyEqual>::rehash(size_t n)
+	{
+		unsigned bits_ = 3;
+		while ((size_t(1) << bits_) < n) bits_++;
+		if (bits_ == bits)
+		{
+			_migrate(0);
+			return;
+		}
+		_grow(bits_);
+		_migrate(0);
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	void hash_table<Key, Value, KeyOf, Hash, KeyEqual>::reserve(size_t n)
+	{
+		const auto needed = static_cast<size_t>(static_cast<float>(n) / max_load) + 1;
+		if (needed > buckets.size()) rehash(needed);
+	}
+
+	template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+	fixed_block_pool::Stats hash_table<Key, Value, KeyOf, Hash, KeyEqual>::pool_stats() const noexcept
+	{
+		return pool ? pool->stats() : fixed_block_pool::Stats{ 0, 0, 0, 0, 0 };
+	}
+
+	template<typename Key, typename T, typename Hash, typename KeyEqual>
+	T& unordered_map<Key, T, Hash, KeyEqual>::operator[](const Key& key)
+	{
+		auto iter = this->find(key);
+		if (iter != this->end()) return iter->second;
+		return this->emplace(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple()).first->second;
+	}
+
+	template<typename Key, typename T, typename Hash, typename KeyEqual>
+	T& unordered_map<Key, T, Hash, KeyEqual>::at(const Key& key)
+	{
+		auto iter = this->find(key);
+		if (iter == this->end()) throw std::out_of_range("Key not found in tvj::unordered_map.");
+		return iter->second;
+	}
+
+	template<typename Key, typename T, typename Hash, typename KeyEqual>
+	const T& unordered_map<Key, T, Hash, KeyEqual>::at(const Key& key) const
+	{
+		auto iter = this->find(key);
+		if (iter == this->end()) throw std::out_of_range("Key not found in tvj::unordered_map.");
+		return iter->second;
+	}
+};
+
+// ALL RIGHTS RESERVED (C) 2026 Teddy van Jerry